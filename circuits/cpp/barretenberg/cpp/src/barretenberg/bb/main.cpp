@@ -2,6 +2,8 @@
 #include "get_crs.hpp"
 #include "get_witness.hpp"
 #include "log.hpp"
+#include "proving_key_cache.hpp"
+#include "serve.hpp"
 #include <barretenberg/common/container.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
@@ -18,6 +20,8 @@ using namespace barretenberg;
 // size.
 uint32_t MAX_CIRCUIT_SIZE = 1 << 23;
 std::string CRS_PATH = "./crs";
+std::string PK_CACHE_PATH = "./pk_cache";
+bool use_pk_cache = true;
 bool verbose = false;
 
 void init()
@@ -40,6 +44,40 @@ acir_format::acir_format get_constraint_system(std::string const& bytecode_path)
     return acir_format::circuit_buf_to_acir_format(bytecode);
 }
 
+/**
+ * @brief Gets the constraint system for a circuit, and gives the composer the circuit's proving key if it is in the
+ * proving key cache. Otherwise computes the key, and adds it to the cache for later runs.
+ *
+ * @param acir_composer The composer that will prove the circuit
+ * @param bytecodePath Path to the file containing the serialized circuit
+ * @return The constraint system (computing the proving key consumes it, so it is parsed again in that case)
+ */
+acir_format::acir_format init_proving_key(acir_proofs::AcirComposer& acir_composer, const std::string& bytecodePath)
+{
+    auto bytecode = get_bytecode(bytecodePath);
+    auto constraint_system = acir_format::circuit_buf_to_acir_format(bytecode);
+    if (!use_pk_cache) {
+        return constraint_system;
+    }
+
+    auto crs_factory = srs::get_crs_factory();
+    auto cache_id = proving_key_cache::get_cache_id(bytecode, crs_factory->get_verifier_crs()->get_g2x());
+    auto key_data = proving_key_cache::read(PK_CACHE_PATH, cache_id);
+    if (key_data) {
+        acir_composer.load_proving_key(crs_factory, std::move(*key_data));
+        return constraint_system;
+    }
+
+    acir_composer.init_proving_key(crs_factory, constraint_system);
+    try {
+        proving_key_cache::write(PK_CACHE_PATH, cache_id, *acir_composer.get_proving_key());
+    } catch (std::exception const& e) {
+        // Failing to cache the key only costs later runs time, so is not an error.
+        vinfo("failed to cache proving key: ", e.what());
+    }
+    return acir_format::circuit_buf_to_acir_format(bytecode);
+}
+
 /**
  * @brief Proves and Verifies an ACIR circuit
  *
@@ -56,7 +94,7 @@ acir_format::acir_format get_constraint_system(std::string const& bytecode_path)
 bool proveAndVerify(const std::string& bytecodePath, const std::string& witnessPath, bool recursive)
 {
     auto acir_composer = new acir_proofs::AcirComposer(MAX_CIRCUIT_SIZE, verbose);
-    auto constraint_system = get_constraint_system(bytecodePath);
+    auto constraint_system = init_proving_key(*acir_composer, bytecodePath);
     auto witness = get_witness(witnessPath);
     auto proof = acir_composer->create_proof(srs::get_crs_factory(), constraint_system, witness, recursive);
     auto verified = acir_composer->verify_proof(proof, recursive);
@@ -83,7 +121,7 @@ void prove(const std::string& bytecodePath,
            const std::string& outputPath)
 {
     auto acir_composer = new acir_proofs::AcirComposer(MAX_CIRCUIT_SIZE, verbose);
-    auto constraint_system = get_constraint_system(bytecodePath);
+    auto constraint_system = init_proving_key(*acir_composer, bytecodePath);
     auto witness = get_witness(witnessPath);
     auto proof = acir_composer->create_proof(srs::get_crs_factory(), constraint_system, witness, recursive);
 
@@ -156,8 +194,12 @@ bool verify(const std::string& proof_path, bool recursive, const std::string& vk
 void writeVk(const std::string& bytecodePath, const std::string& outputPath)
 {
     auto acir_composer = new acir_proofs::AcirComposer(MAX_CIRCUIT_SIZE, verbose);
-    auto constraint_system = get_constraint_system(bytecodePath);
-    acir_composer->init_proving_key(srs::get_crs_factory(), constraint_system);
+    if (use_pk_cache) {
+        init_proving_key(*acir_composer, bytecodePath);
+    } else {
+        auto constraint_system = get_constraint_system(bytecodePath);
+        acir_composer->init_proving_key(srs::get_crs_factory(), constraint_system);
+    }
     auto vk = acir_composer->init_verification_key();
     auto serialized_vk = to_buffer(*vk);
     if (outputPath == "-") {
@@ -272,6 +314,28 @@ void vkAsFields(const std::string& vk_path, const std::string& output_path)
     }
 }
 
+/**
+ * @brief Runs as a daemon that keeps the CRS and the proving keys of the circuits it has seen in memory, and serves
+ * prove, verify and write_vk requests (see serve.hpp for the protocol)
+ *
+ * Communication:
+ * - stdin/stdout: Requests are read from stdin and responses written to stdout, unless a socket path is given.
+ *   The daemon exits once stdin is closed and every request has been answered.
+ * - Unix domain socket: If a socket path is given, the daemon listens on it and serves any number of connections.
+ *
+ * @param socket_path Path of the Unix domain socket to listen on, or empty to serve stdin/stdout
+ * @param num_runners The number of requests that run at once
+ */
+void serve(const std::string& socket_path, size_t num_runners)
+{
+    bb_serve::Server server(PK_CACHE_PATH, use_pk_cache, num_runners);
+    if (socket_path.empty()) {
+        server.serve_pipe(STDIN_FILENO, STDOUT_FILENO);
+    } else {
+        server.serve_socket(socket_path);
+    }
+}
+
 bool flagPresent(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -301,6 +365,8 @@ int main(int argc, char* argv[])
         std::string proof_path = getOption(args, "-p", "./proofs/proof");
         std::string vk_path = getOption(args, "-k", "./target/vk");
         CRS_PATH = getOption(args, "-c", "./crs");
+        PK_CACHE_PATH = getOption(args, "--pk-cache", "./pk_cache");
+        use_pk_cache = !flagPresent(args, "--no-pk-cache");
         bool recursive = flagPresent(args, "-r") || flagPresent(args, "--recursive");
         init();
 
@@ -325,6 +391,9 @@ int main(int argc, char* argv[])
         } else if (command == "vk_as_fields") {
             std::string output_path = getOption(args, "-o", vk_path + "_fields.json");
             vkAsFields(vk_path, output_path);
+        } else if (command == "serve") {
+            std::string socket_path = getOption(args, "--socket", "");
+            serve(socket_path, std::stoul(getOption(args, "-j", "2")));
         } else {
             std::cerr << "Unknown command: " << command << "\n";
             return 1;
@@ -0,0 +1,83 @@
+#pragma once
+#include "file_io.hpp"
+#include "log.hpp"
+#include <barretenberg/crypto/sha256/sha256.hpp>
+#include <barretenberg/ecc/curves/bn254/g2.hpp>
+#include <barretenberg/plonk/proof_system/proving_key/serialize.hpp>
+#include <filesystem>
+#include <optional>
+#include <unistd.h>
+
+/**
+ * Computing a proving key (every selector, sigma and table polynomial, and their coset FFTs) is often most of the
+ * work of a proof, yet depends only on the circuit. The cache keeps keys on disk, named by a hash of the circuit's
+ * bytecode and of the CRS, so repeated runs on the same circuit load the key instead of rebuilding it.
+ *
+ * Keys are stored in the memory mapped format (see write_mmap in plonk/proof_system/proving_key/serialize.hpp), so
+ * loading one maps the file rather than parsing it, and a truncated or stale file is detected and rebuilt. Files are
+ * written under a temporary name and renamed into place, so concurrent runs never see a partial file.
+ */
+namespace proving_key_cache {
+
+// Bump whenever the proving key or its serialization changes, so stale entries are not picked up.
+constexpr uint32_t CACHE_VERSION = 2;
+
+/**
+ * @brief The name of the cache entry for a circuit: the hex sha256 of the cache version, the (decompressed) bytecode
+ * and the CRS's G2 point.
+ */
+inline std::string get_cache_id(std::vector<uint8_t> const& bytecode, barretenberg::g2::affine_element const& g2x)
+{
+    std::vector<uint8_t> hash_input;
+    serialize::write(hash_input, CACHE_VERSION);
+    hash_input.insert(hash_input.end(), bytecode.begin(), bytecode.end());
+    auto g2_bytes = reinterpret_cast<uint8_t const*>(&g2x);
+    hash_input.insert(hash_input.end(), g2_bytes, g2_bytes + sizeof(g2x));
+    auto hash = sha256::sha256(hash_input);
+
+    constexpr char hex_digits[] = "0123456789abcdef";
+    std::string id;
+    for (auto byte : hash) {
+        id += hex_digits[byte >> 4];
+        id += hex_digits[byte & 15];
+    }
+    return id;
+}
+
+inline std::filesystem::path get_cache_path(std::filesystem::path const& cache_dir, std::string const& id)
+{
+    return cache_dir / (id + ".pk");
+}
+
+inline std::optional<proof_system::plonk::proving_key_data> read(std::filesystem::path const& cache_dir,
+                                                                 std::string const& id)
+{
+    auto path = get_cache_path(cache_dir, id);
+    if (!std::filesystem::exists(path)) {
+        return std::nullopt;
+    }
+
+    proof_system::plonk::proving_key_data key_data;
+    try {
+        proof_system::plonk::read_mmap(path, key_data);
+    } catch (std::exception const& e) {
+        vinfo("ignoring invalid cached proving key: ", e.what());
+        std::filesystem::remove(path);
+        return std::nullopt;
+    }
+    vinfo("loaded cached proving key: ", path);
+    return key_data;
+}
+
+inline void write(std::filesystem::path const& cache_dir, std::string const& id, proof_system::plonk::proving_key& key)
+{
+    std::filesystem::create_directories(cache_dir);
+    auto path = get_cache_path(cache_dir, id);
+    auto tmp_path = path;
+    tmp_path += format(".", getpid(), ".tmp");
+    proof_system::plonk::write_mmap(tmp_path, key);
+    std::filesystem::rename(tmp_path, path);
+    vinfo("cached proving key: ", path);
+}
+
+} // namespace proving_key_cache
@@ -0,0 +1,462 @@
+#pragma once
+#include "log.hpp"
+#include "proving_key_cache.hpp"
+#include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
+#include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
+#include <barretenberg/ecc/curves/grumpkin/grumpkin.hpp>
+#include <barretenberg/ecc/curves/secp256k1/secp256k1.hpp>
+#include <barretenberg/ecc/curves/secp256r1/secp256r1.hpp>
+#include <barretenberg/proof_system/plookup_tables/plookup_tables.hpp>
+#include <barretenberg/serialize/cbind.hpp>
+#include <barretenberg/srs/global_crs.hpp>
+#include <cerrno>
+#include <condition_variable>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <thread>
+#include <unistd.h>
+
+/**
+ * `bb serve` keeps the CRS, the plookup tables and the proving keys of the circuits it has seen in memory, and proves
+ * and verifies for clients over a pipe (stdin/stdout) or a Unix domain socket. A client that makes many small proofs
+ * then pays for process start-up and key construction once, rather than once per proof.
+ *
+ * Messages in both directions are frames: a 4 byte big-endian length, then that many bytes of msgpack. Requests are
+ * run by a pool of runners, so independent requests overlap and responses may come back in a different order than
+ * the requests were sent; the id of a response is that of its request.
+ */
+namespace bb_serve {
+
+/**
+ * @brief A request. Every field must be present in the msgpack map; fields the command does not use may be empty.
+ *
+ * - "prove": `bytecode` and `witness`, decompressed (i.e. what `gunzip` gives for the files the other commands read).
+ *   The result is the proof.
+ * - "verify": `proof` and `vk`. The result is a single byte, 1 if the proof is valid and 0 otherwise.
+ * - "write_vk": `bytecode`. The result is the serialized verification key.
+ */
+struct Request {
+    uint64_t id = 0;
+    std::string command;
+    std::vector<uint8_t> bytecode;
+    std::vector<uint8_t> witness;
+    std::vector<uint8_t> proof;
+    std::vector<uint8_t> vk;
+    bool recursive = false;
+    MSGPACK_FIELDS(id, command, bytecode, witness, proof, vk, recursive);
+};
+
+struct Response {
+    uint64_t id = 0;
+    bool success = false;
+    std::string error;
+    std::vector<uint8_t> result;
+    MSGPACK_FIELDS(id, success, error, result);
+};
+
+/**
+ * @brief Reads exactly `size` bytes. Returns false if the stream ends first.
+ */
+inline bool read_exact(int fd, uint8_t* data, size_t size)
+{
+    while (size > 0) {
+        auto n = ::read(fd, data, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+inline bool write_exact(int fd, uint8_t const* data, size_t size)
+{
+    while (size > 0) {
+        auto n = ::write(fd, data, size);
+        if (n < 0 && errno == EINTR) {
+            continue;
+        }
+        if (n <= 0) {
+            return false;
+        }
+        data += n;
+        size -= static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * @brief Reads the body of the next frame, or nothing if the stream has ended.
+ */
+inline std::optional<std::vector<uint8_t>> read_frame(int fd)
+{
+    uint8_t header[4];
+    if (!read_exact(fd, header, sizeof(header))) {
+        return std::nullopt;
+    }
+    auto it = (uint8_t const*)header;
+    uint32_t size = 0;
+    serialize::read(it, size);
+    std::vector<uint8_t> body(size);
+    if (!read_exact(fd, body.data(), size)) {
+        throw std::runtime_error("stream ended part way through a frame");
+    }
+    return body;
+}
+
+inline bool write_frame(int fd, std::vector<uint8_t> const& body)
+{
+    std::vector<uint8_t> frame;
+    frame.reserve(4 + body.size());
+    serialize::write(frame, static_cast<uint32_t>(body.size()));
+    frame.insert(frame.end(), body.begin(), body.end());
+    return write_exact(fd, frame.data(), frame.size());
+}
+
+/**
+ * @brief A proving key that is never used to prove directly, only shared with per-request keys. Provers add their
+ * witness polynomials to the key's store, so concurrent proofs cannot use the same proving_key.
+ */
+struct ResidentCircuit {
+    std::shared_ptr<proof_system::plonk::proving_key> proving_key;
+    std::once_flag vk_flag;
+    std::vector<uint8_t> vk;
+
+    /**
+     * @brief The data for a new proving key whose precomputed polynomials share memory with the resident key's.
+     */
+    proof_system::plonk::proving_key_data share_proving_key() const
+    {
+        proof_system::plonk::proving_key_data data{
+            .circuit_type = static_cast<uint32_t>(proving_key->circuit_type),
+            .circuit_size = static_cast<uint32_t>(proving_key->circuit_size),
+            .num_public_inputs = static_cast<uint32_t>(proving_key->num_public_inputs),
+            .contains_recursive_proof = proving_key->contains_recursive_proof,
+            .recursive_proof_public_input_indices = proving_key->recursive_proof_public_input_indices,
+            .memory_read_records = proving_key->memory_read_records,
+            .memory_write_records = proving_key->memory_write_records,
+            .polynomial_store = {},
+        };
+        proof_system::plonk::PrecomputedPolyList precomputed_poly_list(proving_key->circuit_type);
+        for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+            auto const& label = precomputed_poly_list[i];
+            data.polynomial_store.put(label, proving_key->polynomial_store.get(label));
+        }
+        return data;
+    }
+};
+
+class Server {
+  public:
+    Server(std::filesystem::path pk_cache_path, bool use_pk_cache, size_t num_runners)
+        : pk_cache_path_(std::move(pk_cache_path))
+        , use_pk_cache_(use_pk_cache)
+        , crs_factory_(barretenberg::srs::get_crs_factory())
+    {
+        // A client going away should not take the server with it; the failed write is enough.
+        std::signal(SIGPIPE, SIG_IGN);
+
+        // Build the lazily initialised global tables now, as building them is not safe from several runners at once.
+        plookup::initialize_multi_tables();
+        grumpkin::get_generator(0);
+        secp256k1::get_generator(0);
+        secp256r1::get_generator(0);
+
+        for (size_t i = 0; i < std::max(num_runners, size_t(1)); ++i) {
+            runners_.emplace_back([this] { run(); });
+        }
+    }
+
+    Server(const Server& other) = delete;
+    Server(Server&& other) = delete;
+    Server& operator=(const Server& other) = delete;
+    Server& operator=(Server&& other) = delete;
+
+    ~Server()
+    {
+        {
+            std::unique_lock lock(queue_mutex_);
+            stopping_ = true;
+        }
+        queue_condition_.notify_all();
+        for (auto& runner : runners_) {
+            runner.join();
+        }
+    }
+
+    /**
+     * @brief Serves the requests read from `in_fd`, writing responses to `out_fd`. Returns once the input has ended
+     * and every request read from it has been answered.
+     */
+    void serve_pipe(int in_fd, int out_fd)
+    {
+        auto connection = std::make_shared<Connection>(out_fd, false);
+        read_requests(in_fd, connection);
+        std::unique_lock lock(queue_mutex_);
+        idle_condition_.wait(lock, [&] { return queue_.empty() && num_running_ == 0; });
+    }
+
+    /**
+     * @brief Listens on a Unix domain socket at `path`, serving each connection as a pipe. Does not return.
+     */
+    void serve_socket(std::string const& path)
+    {
+        sockaddr_un address{};
+        address.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(address.sun_path)) {
+            throw std::runtime_error("socket path is too long: " + path);
+        }
+        std::strncpy(address.sun_path, path.c_str(), sizeof(address.sun_path) - 1);
+
+        int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+        if (listen_fd < 0) {
+            throw std::runtime_error(std::string("failed to create socket: ") + std::strerror(errno));
+        }
+        ::unlink(path.c_str());
+        if (::bind(listen_fd, (sockaddr*)&address, sizeof(address)) != 0 || ::listen(listen_fd, SOMAXCONN) != 0) {
+            throw std::runtime_error("failed to listen on " + path + ": " + std::strerror(errno));
+        }
+        vinfo("listening on: ", path);
+
+        while (true) {
+            int fd = ::accept(listen_fd, nullptr, nullptr);
+            if (fd < 0) {
+                if (errno != EINTR) {
+                    vinfo("failed to accept connection: ", std::strerror(errno));
+                }
+                continue;
+            }
+            // The connection closes once its reader is done and its last response has been written.
+            auto connection = std::make_shared<Connection>(fd, true);
+            std::thread([this, fd, connection] { read_requests(fd, connection); }).detach();
+        }
+    }
+
+    /**
+     * @brief Runs a request on the calling thread.
+     */
+    Response handle(Request const& request)
+    {
+        Response response{ .id = request.id, .success = false, .error = {}, .result = {} };
+        try {
+            if (request.command == "prove") {
+                response.result = prove(request);
+            } else if (request.command == "verify") {
+                response.result = { static_cast<uint8_t>(verify(request) ? 1 : 0) };
+            } else if (request.command == "write_vk") {
+                response.result = write_vk(request);
+            } else {
+                throw std::runtime_error("unknown command: " + request.command);
+            }
+            response.success = true;
+        } catch (std::exception const& e) {
+            response.error = e.what();
+        }
+        return response;
+    }
+
+  private:
+    struct Connection {
+        int fd;
+        bool owns_fd;
+        std::mutex write_mutex;
+
+        Connection(int fd, bool owns_fd)
+            : fd(fd)
+            , owns_fd(owns_fd)
+        {}
+        Connection(const Connection& other) = delete;
+        Connection(Connection&& other) = delete;
+        Connection& operator=(const Connection& other) = delete;
+        Connection& operator=(Connection&& other) = delete;
+        ~Connection()
+        {
+            if (owns_fd) {
+                ::close(fd);
+            }
+        }
+
+        void write(Response const& response)
+        {
+            msgpack::sbuffer buffer;
+            msgpack::pack(buffer, response);
+            std::unique_lock lock(write_mutex);
+            if (!write_frame(fd, { (uint8_t*)buffer.data(), (uint8_t*)buffer.data() + buffer.size() })) {
+                vinfo("failed to write response ", response.id);
+            }
+        }
+    };
+
+    struct Job {
+        std::vector<uint8_t> request;
+        std::shared_ptr<Connection> connection;
+    };
+
+    void read_requests(int fd, std::shared_ptr<Connection> const& connection)
+    {
+        try {
+            while (auto frame = read_frame(fd)) {
+                {
+                    std::unique_lock lock(queue_mutex_);
+                    queue_.push_back({ std::move(*frame), connection });
+                }
+                queue_condition_.notify_one();
+            }
+        } catch (std::exception const& e) {
+            vinfo("dropping connection: ", e.what());
+        }
+    }
+
+    void run()
+    {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock lock(queue_mutex_);
+                queue_condition_.wait(lock, [&] { return stopping_ || !queue_.empty(); });
+                if (queue_.empty()) {
+                    return;
+                }
+                job = std::move(queue_.front());
+                queue_.pop_front();
+                num_running_++;
+            }
+
+            Request request;
+            Response response;
+            try {
+                msgpack::unpack((char const*)job.request.data(), job.request.size()).get().convert(request);
+                vinfo("request ", request.id, ": ", request.command);
+                response = handle(request);
+            } catch (std::exception const& e) {
+                response = { .id = request.id, .success = false, .error = e.what(), .result = {} };
+            }
+            job.connection->write(response);
+            job = {};
+
+            {
+                std::unique_lock lock(queue_mutex_);
+                num_running_--;
+            }
+            idle_condition_.notify_all();
+        }
+    }
+
+    /**
+     * @brief Gets the resident circuit for some bytecode. The first request for a circuit loads its proving key from
+     * the proving key cache, or computes it; requests for the same circuit that arrive meanwhile wait for that.
+     */
+    std::shared_ptr<ResidentCircuit> get_circuit(std::vector<uint8_t> const& bytecode)
+    {
+        auto cache_id = proving_key_cache::get_cache_id(bytecode, crs_factory_->get_verifier_crs()->get_g2x());
+
+        std::promise<std::shared_ptr<ResidentCircuit>> promise;
+        std::shared_future<std::shared_ptr<ResidentCircuit>> circuit;
+        bool is_loader = false;
+        {
+            std::unique_lock lock(circuits_mutex_);
+            auto it = circuits_.find(cache_id);
+            if (it == circuits_.end()) {
+                circuit = promise.get_future().share();
+                circuits_.emplace(cache_id, circuit);
+                is_loader = true;
+            } else {
+                circuit = it->second;
+            }
+        }
+
+        if (is_loader) {
+            try {
+                promise.set_value(load_circuit(cache_id, bytecode));
+            } catch (...) {
+                // Let a later request try again, rather than failing every request for the circuit from now on.
+                {
+                    std::unique_lock lock(circuits_mutex_);
+                    circuits_.erase(cache_id);
+                }
+                promise.set_exception(std::current_exception());
+            }
+        }
+        return circuit.get();
+    }
+
+    std::shared_ptr<ResidentCircuit> load_circuit(std::string const& cache_id, std::vector<uint8_t> const& bytecode)
+    {
+        auto circuit = std::make_shared<ResidentCircuit>();
+        acir_proofs::AcirComposer acir_composer(0, verbose);
+        auto key_data = use_pk_cache_ ? proving_key_cache::read(pk_cache_path_, cache_id) : std::nullopt;
+        if (key_data) {
+            acir_composer.load_proving_key(crs_factory_, std::move(*key_data));
+        } else {
+            auto constraint_system = acir_format::circuit_buf_to_acir_format(bytecode);
+            acir_composer.init_proving_key(crs_factory_, constraint_system);
+            if (use_pk_cache_) {
+                try {
+                    proving_key_cache::write(pk_cache_path_, cache_id, *acir_composer.get_proving_key());
+                } catch (std::exception const& e) {
+                    vinfo("failed to cache proving key: ", e.what());
+                }
+            }
+        }
+        circuit->proving_key = acir_composer.get_proving_key();
+        return circuit;
+    }
+
+    std::vector<uint8_t> prove(Request const& request)
+    {
+        auto circuit = get_circuit(request.bytecode);
+        acir_proofs::AcirComposer acir_composer(0, verbose);
+        acir_composer.load_proving_key(crs_factory_, circuit->share_proving_key());
+        auto constraint_system = acir_format::circuit_buf_to_acir_format(request.bytecode);
+        auto witness = acir_format::witness_buf_to_witness_data(request.witness);
+        return acir_composer.create_proof(crs_factory_, constraint_system, witness, request.recursive);
+    }
+
+    bool verify(Request const& request)
+    {
+        acir_proofs::AcirComposer acir_composer(0, verbose);
+        auto vk_data = from_buffer<proof_system::plonk::verification_key_data>(request.vk);
+        acir_composer.load_verification_key(crs_factory_, std::move(vk_data));
+        return acir_composer.verify_proof(request.proof, request.recursive);
+    }
+
+    std::vector<uint8_t> write_vk(Request const& request)
+    {
+        auto circuit = get_circuit(request.bytecode);
+        std::call_once(circuit->vk_flag, [&] {
+            acir_proofs::AcirComposer acir_composer(0, verbose);
+            acir_composer.load_proving_key(crs_factory_, circuit->share_proving_key());
+            circuit->vk = to_buffer(*acir_composer.init_verification_key());
+        });
+        return circuit->vk;
+    }
+
+    std::filesystem::path pk_cache_path_;
+    bool use_pk_cache_;
+    std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> crs_factory_;
+
+    // Resident circuits are never evicted: a server is expected to see a small, fixed set of circuits.
+    std::mutex circuits_mutex_;
+    std::map<std::string, std::shared_future<std::shared_ptr<ResidentCircuit>>> circuits_;
+
+    std::mutex queue_mutex_;
+    std::condition_variable queue_condition_;
+    std::condition_variable idle_condition_;
+    std::deque<Job> queue_;
+    size_t num_running_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> runners_;
+};
+
+} // namespace bb_serve
@@ -0,0 +1,212 @@
+#pragma once
+#include "assert.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace barretenberg {
+
+/**
+ * @brief A vector that grows by adding chunks rather than by reallocating, so elements never move once added.
+ *
+ * @details The chunks double in size: chunk k holds FIRST_CHUNK_SIZE * 2^k elements, and so starts at index
+ * FIRST_CHUNK_SIZE * (2^k - 1). The chunk holding an element is therefore found from the position of the top bit of
+ * its index plus FIRST_CHUNK_SIZE, with no search, and the table of chunks is a fixed array rather than a further
+ * heap allocation. Growth allocates one new chunk and copies nothing, small vectors stay small, and reserve() allocates
+ * up front every chunk a size needs. Elements must be default constructible; chunk storage is default-initialised.
+ */
+template <typename T, size_t LOG2_FIRST_CHUNK_SIZE = 10> class ChunkedVector {
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using reference = T&;
+    using const_reference = const T&;
+
+    template <bool IS_CONST> class Iterator {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IS_CONST, const T*, T*>;
+        using reference = std::conditional_t<IS_CONST, const T&, T&>;
+        using Container = std::conditional_t<IS_CONST, const ChunkedVector, ChunkedVector>;
+
+        Iterator() = default;
+        Iterator(Container* container, size_t index)
+            : container(container)
+            , index(index)
+        {}
+
+        reference operator*() const { return (*container)[index]; }
+        pointer operator->() const { return &(*container)[index]; }
+        reference operator[](difference_type n) const { return (*container)[index + static_cast<size_t>(n)]; }
+        Iterator& operator++()
+        {
+            ++index;
+            return *this;
+        }
+        Iterator operator++(int)
+        {
+            Iterator result = *this;
+            ++index;
+            return result;
+        }
+        Iterator& operator--()
+        {
+            --index;
+            return *this;
+        }
+        Iterator operator--(int)
+        {
+            Iterator result = *this;
+            --index;
+            return result;
+        }
+        Iterator& operator+=(difference_type n)
+        {
+            index += static_cast<size_t>(n);
+            return *this;
+        }
+        Iterator& operator-=(difference_type n)
+        {
+            index -= static_cast<size_t>(n);
+            return *this;
+        }
+        friend Iterator operator+(Iterator it, difference_type n) { return it += n; }
+        friend Iterator operator+(difference_type n, Iterator it) { return it += n; }
+        friend Iterator operator-(Iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const Iterator& a, const Iterator& b)
+        {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+        friend bool operator==(const Iterator& a, const Iterator& b) { return a.index == b.index; }
+        friend auto operator<=>(const Iterator& a, const Iterator& b) { return a.index <=> b.index; }
+
+      private:
+        Container* container = nullptr;
+        size_t index = 0;
+    };
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    ChunkedVector() = default;
+    ChunkedVector(const ChunkedVector& other) { *this = other; }
+    ChunkedVector(ChunkedVector&& other) noexcept
+        : chunks(std::move(other.chunks))
+        , num_chunks(std::exchange(other.num_chunks, 0))
+        , size_(std::exchange(other.size_, 0))
+    {}
+    ChunkedVector& operator=(const ChunkedVector& other)
+    {
+        if (this == &other) {
+            return *this;
+        }
+        clear();
+        reserve(other.size_);
+        for (size_t k = 0; k < other.num_chunks && chunk_start(k) < other.size_; ++k) {
+            const size_t count = std::min(chunk_size(k), other.size_ - chunk_start(k));
+            std::copy(other.chunks[k].get(), other.chunks[k].get() + count, chunks[k].get());
+        }
+        size_ = other.size_;
+        return *this;
+    }
+    ChunkedVector& operator=(ChunkedVector&& other) noexcept
+    {
+        chunks = std::move(other.chunks);
+        num_chunks = std::exchange(other.num_chunks, 0);
+        size_ = std::exchange(other.size_, 0);
+        return *this;
+    }
+    ~ChunkedVector() = default;
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    size_t capacity() const { return chunk_start(num_chunks); }
+
+    T& operator[](size_t index)
+    {
+        const auto [chunk, offset] = locate(index);
+        return chunks[chunk][offset];
+    }
+    const T& operator[](size_t index) const
+    {
+        const auto [chunk, offset] = locate(index);
+        return chunks[chunk][offset];
+    }
+    T& back() { return (*this)[size_ - 1]; }
+    const T& back() const { return (*this)[size_ - 1]; }
+
+    iterator begin() { return { this, 0 }; }
+    iterator end() { return { this, size_ }; }
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, size_ }; }
+
+    /**
+     * @brief Allocates the chunks needed to hold new_capacity elements, so adding that many never allocates.
+     */
+    void reserve(size_t new_capacity)
+    {
+        while (capacity() < new_capacity) {
+            ASSERT(num_chunks < MAX_NUM_CHUNKS);
+            // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+            chunks[num_chunks] = std::unique_ptr<T[]>(new T[chunk_size(num_chunks)]);
+            ++num_chunks;
+        }
+    }
+
+    template <typename... Args> T& emplace_back(Args&&... args)
+    {
+        reserve(size_ + 1);
+        T& element = (*this)[size_];
+        element = T(std::forward<Args>(args)...);
+        ++size_;
+        return element;
+    }
+    void push_back(const T& value) { emplace_back(value); }
+
+    /**
+     * @brief Drops every element but keeps the chunks, so the vector can be refilled without allocating.
+     */
+    void clear() { size_ = 0; }
+
+    /**
+     * @brief Drops the elements from new_size on, keeping their chunks.
+     */
+    void truncate(size_t new_size)
+    {
+        ASSERT(new_size <= size_);
+        size_ = new_size;
+    }
+
+    bool operator==(const ChunkedVector& other) const
+    {
+        return size_ == other.size_ && std::equal(begin(), end(), other.begin());
+    }
+
+  private:
+    static constexpr size_t FIRST_CHUNK_SIZE = size_t(1) << LOG2_FIRST_CHUNK_SIZE;
+    // Enough chunks for any index below 2^40
+    static constexpr size_t MAX_NUM_CHUNKS = 40 - LOG2_FIRST_CHUNK_SIZE;
+
+    static constexpr size_t chunk_size(size_t chunk) { return FIRST_CHUNK_SIZE << chunk; }
+    static constexpr size_t chunk_start(size_t chunk) { return FIRST_CHUNK_SIZE * ((size_t(1) << chunk) - 1); }
+
+    static std::pair<size_t, size_t> locate(size_t index)
+    {
+        const size_t shifted = index + FIRST_CHUNK_SIZE;
+        const size_t top_bit = static_cast<size_t>(std::bit_width(shifted)) - 1;
+        return { top_bit - LOG2_FIRST_CHUNK_SIZE, shifted - (size_t(1) << top_bit) };
+    }
+
+    std::array<std::unique_ptr<T[]>, MAX_NUM_CHUNKS> chunks;
+    size_t num_chunks = 0;
+    size_t size_ = 0;
+};
+
+} // namespace barretenberg
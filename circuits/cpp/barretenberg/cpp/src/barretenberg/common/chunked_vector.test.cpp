@@ -0,0 +1,54 @@
+#include "chunked_vector.hpp"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace barretenberg;
+
+TEST(chunked_vector, GrowsWithoutMovingElements)
+{
+    constexpr size_t num_elements = 100000;
+    ChunkedVector<uint64_t, 4> vector;
+    std::vector<const uint64_t*> addresses;
+    for (size_t i = 0; i < num_elements; ++i) {
+        addresses.push_back(&vector.emplace_back(i * 3));
+    }
+    EXPECT_EQ(vector.size(), num_elements);
+    EXPECT_EQ(vector.back(), (num_elements - 1) * 3);
+    for (size_t i = 0; i < num_elements; ++i) {
+        EXPECT_EQ(vector[i], i * 3);
+        EXPECT_EQ(&vector[i], addresses[i]);
+    }
+}
+
+TEST(chunked_vector, ReserveAllocatesUpFront)
+{
+    ChunkedVector<uint32_t, 4> vector;
+    vector.reserve(1000);
+    const size_t capacity = vector.capacity();
+    EXPECT_GE(capacity, 1000UL);
+    for (uint32_t i = 0; i < 1000; ++i) {
+        vector.push_back(i);
+    }
+    EXPECT_EQ(vector.capacity(), capacity);
+}
+
+TEST(chunked_vector, CopyCompareAndIterate)
+{
+    ChunkedVector<uint32_t, 2> vector;
+    for (uint32_t i = 0; i < 50; ++i) {
+        vector.push_back(50 - i);
+    }
+    auto copy = vector;
+    EXPECT_EQ(copy, vector);
+    copy[20] = 0;
+    EXPECT_FALSE(copy == vector);
+
+    std::sort(copy.begin(), copy.end());
+    EXPECT_TRUE(std::is_sorted(copy.begin(), copy.end()));
+    EXPECT_EQ(copy[0], 0U);
+
+    auto moved = std::move(copy);
+    EXPECT_EQ(moved.size(), 50UL);
+    EXPECT_EQ(moved[0], 0U);
+}
@@ -0,0 +1,147 @@
+#pragma once
+#include "throw_or_abort.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief An insert-only hash map using open addressing with linear probing.
+ *
+ * @details Entries are kept contiguously in insertion order, and the table itself is a power-of-two array of 32 bit
+ * entry indices, so a lookup touches one small array and then the one entry it probes to, rather than chasing the
+ * nodes of a tree or of bucket lists. There is no erase, which keeps probing simple: a slot is either empty or holds
+ * an entry for good. Iteration is in insertion order, so it is deterministic whatever the hash.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>> class FlatHashMap {
+  public:
+    using value_type = std::pair<Key, Value>;
+
+    size_t size() const { return entries.size(); }
+    bool empty() const { return entries.empty(); }
+    auto begin() const { return entries.begin(); }
+    auto end() const { return entries.end(); }
+
+    /**
+     * @brief Sizes the table for the given number of entries up front, so inserting them does not rehash.
+     */
+    void reserve(size_t num_entries)
+    {
+        entries.reserve(num_entries);
+        size_t capacity = MIN_CAPACITY;
+        while (capacity * MAX_LOAD_NUMERATOR < num_entries * MAX_LOAD_DENOMINATOR) {
+            capacity *= 2;
+        }
+        if (capacity > slots.size()) {
+            rehash(capacity);
+        }
+    }
+
+    /**
+     * @brief Returns a pointer to the value for key, or nullptr if there is none.
+     */
+    const Value* find(const Key& key) const
+    {
+        if (slots.empty()) {
+            return nullptr;
+        }
+        uint32_t index = slots[find_slot(key)];
+        return index == EMPTY ? nullptr : &entries[index].second;
+    }
+
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    const Value& at(const Key& key) const
+    {
+        const Value* value = find(key);
+        if (value == nullptr) {
+            throw_or_abort("FlatHashMap::at: key not found");
+        }
+        return *value;
+    }
+
+    /**
+     * @brief Inserts entry if its key is not present yet. As with std::map, an existing value is left as it is.
+     *
+     * @return Whether the entry was inserted.
+     */
+    bool insert(value_type entry)
+    {
+        if ((entries.size() + 1) * MAX_LOAD_DENOMINATOR > slots.size() * MAX_LOAD_NUMERATOR) {
+            rehash(slots.empty() ? MIN_CAPACITY : slots.size() * 2);
+        }
+        size_t slot = find_slot(entry.first);
+        if (slots[slot] != EMPTY) {
+            return false;
+        }
+        slots[slot] = static_cast<uint32_t>(entries.size());
+        entries.emplace_back(std::move(entry));
+        return true;
+    }
+
+    /**
+     * @brief Removes the entries inserted after the first num_entries, newest first.
+     *
+     * @details Without erase, an entry's probe sequence only passes through slots held by entries inserted before it.
+     * So the newest entry's slot is on no other entry's probe sequence, and can simply be emptied again.
+     */
+    void truncate(size_t num_entries)
+    {
+        while (entries.size() > num_entries) {
+            slots[find_slot(entries.back().first)] = EMPTY;
+            entries.pop_back();
+        }
+    }
+
+    /**
+     * @brief Maps are equal if they hold the same entries, whatever order they were inserted in.
+     */
+    bool operator==(const FlatHashMap& other) const
+    {
+        if (size() != other.size()) {
+            return false;
+        }
+        for (const auto& [key, value] : entries) {
+            const Value* other_value = other.find(key);
+            if (other_value == nullptr || !(*other_value == value)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+  private:
+    static constexpr uint32_t EMPTY = UINT32_MAX;
+    static constexpr size_t MIN_CAPACITY = 16;
+    // The table is grown once it would be more than 3/4 full.
+    static constexpr size_t MAX_LOAD_NUMERATOR = 3;
+    static constexpr size_t MAX_LOAD_DENOMINATOR = 4;
+
+    /**
+     * @brief The slot holding key, or the empty slot where it would go. The table must not be empty.
+     */
+    size_t find_slot(const Key& key) const
+    {
+        const size_t mask = slots.size() - 1;
+        // Hashes such as std::hash on integers are the identity, so mix the bits before masking off the low ones.
+        uint64_t mixed = static_cast<uint64_t>(hasher(key)) * 0x9e3779b97f4a7c15ULL;
+        size_t slot = static_cast<size_t>(mixed ^ (mixed >> 32)) & mask;
+        while (slots[slot] != EMPTY && !(entries[slots[slot]].first == key)) {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    void rehash(size_t capacity)
+    {
+        slots.assign(capacity, EMPTY);
+        for (size_t i = 0; i < entries.size(); ++i) {
+            slots[find_slot(entries[i].first)] = static_cast<uint32_t>(i);
+        }
+    }
+
+    std::vector<value_type> entries;
+    std::vector<uint32_t> slots;
+    [[no_unique_address]] Hash hasher;
+};
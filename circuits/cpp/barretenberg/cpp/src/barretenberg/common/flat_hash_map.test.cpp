@@ -0,0 +1,81 @@
+#include "flat_hash_map.hpp"
+#include <gtest/gtest.h>
+
+TEST(flat_hash_map, InsertAndFind)
+{
+    constexpr uint32_t num_entries = 10000;
+    FlatHashMap<uint64_t, uint32_t> map;
+    for (uint32_t i = 0; i < num_entries; ++i) {
+        EXPECT_TRUE(map.insert({ uint64_t(i) << 20, i }));
+    }
+    EXPECT_EQ(map.size(), num_entries);
+    for (uint32_t i = 0; i < num_entries; ++i) {
+        EXPECT_TRUE(map.contains(uint64_t(i) << 20));
+        EXPECT_EQ(map.at(uint64_t(i) << 20), i);
+    }
+    EXPECT_FALSE(map.contains(1));
+    EXPECT_EQ(map.find(num_entries), nullptr);
+}
+
+TEST(flat_hash_map, InsertKeepsExistingValue)
+{
+    FlatHashMap<uint64_t, uint32_t> map;
+    EXPECT_TRUE(map.insert({ 7, 1 }));
+    EXPECT_FALSE(map.insert({ 7, 2 }));
+    EXPECT_EQ(map.size(), 1UL);
+    EXPECT_EQ(map.at(7), 1U);
+}
+
+TEST(flat_hash_map, IteratesInInsertionOrder)
+{
+    FlatHashMap<uint64_t, uint32_t> map;
+    map.reserve(100);
+    for (uint32_t i = 0; i < 100; ++i) {
+        map.insert({ 1000 - i, i });
+    }
+    uint32_t expected = 0;
+    for (const auto& [key, value] : map) {
+        EXPECT_EQ(key, 1000 - expected);
+        EXPECT_EQ(value, expected++);
+    }
+    EXPECT_EQ(expected, 100U);
+}
+
+TEST(flat_hash_map, EqualityIgnoresInsertionOrder)
+{
+    FlatHashMap<uint64_t, uint32_t> a;
+    FlatHashMap<uint64_t, uint32_t> b;
+    for (uint32_t i = 0; i < 50; ++i) {
+        a.insert({ i, i * 2 });
+        b.insert({ 49 - i, (49 - i) * 2 });
+    }
+    EXPECT_EQ(a, b);
+    b.insert({ 50, 100 });
+    EXPECT_FALSE(a == b);
+    a.insert({ 50, 101 });
+    EXPECT_FALSE(a == b);
+}
+
+TEST(flat_hash_map, TruncateRemovesNewestEntries)
+{
+    // A hash with few distinct values, so that most keys share probe sequences
+    struct CollidingHash {
+        size_t operator()(uint64_t key) const { return key % 3; }
+    };
+    FlatHashMap<uint64_t, uint32_t, CollidingHash> map;
+    for (uint32_t i = 0; i < 10; ++i) {
+        map.insert({ i, i });
+    }
+    // Grow the table past a rehash, then drop the new entries again
+    for (uint32_t i = 10; i < 100; ++i) {
+        map.insert({ i, i });
+    }
+    map.truncate(10);
+    EXPECT_EQ(map.size(), 10UL);
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(map.contains(i), i < 10);
+    }
+    EXPECT_TRUE(map.insert({ 50, 7 }));
+    EXPECT_EQ(map.at(50), 7U);
+    EXPECT_EQ(map.at(9), 9U);
+}
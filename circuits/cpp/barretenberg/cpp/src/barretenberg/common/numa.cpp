@@ -0,0 +1,115 @@
+#include "numa.hpp"
+#include "barretenberg/env/hardware_concurrency.hpp"
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic<bool> numa_enabled = [] {
+    const char* env = std::getenv("BB_NUMA");
+    return env != nullptr && std::strcmp(env, "0") != 0;
+}();
+
+const std::vector<std::vector<uint32_t>>& get_topology()
+{
+    static const auto topology = env_numa_topology();
+    return topology;
+}
+
+// Nodes that have cpus, the only ones worth pinning threads to or placing memory on.
+const std::vector<size_t>& get_cpu_nodes()
+{
+    static const auto cpu_nodes = [] {
+        std::vector<size_t> nodes;
+        const auto& topology = get_topology();
+        for (size_t node = 0; node < topology.size(); ++node) {
+            if (!topology[node].empty()) {
+                nodes.push_back(node);
+            }
+        }
+        return nodes;
+    }();
+    return cpu_nodes;
+}
+
+} // namespace
+
+namespace barretenberg::numa {
+
+void enable(bool enabled)
+{
+    numa_enabled = enabled;
+}
+
+bool is_enabled()
+{
+    return numa_enabled && num_nodes() > 1;
+}
+
+size_t num_nodes()
+{
+    return get_cpu_nodes().size();
+}
+
+void pin_thread([[maybe_unused]] size_t thread_index, [[maybe_unused]] size_t num_threads)
+{
+#ifdef __linux__
+    if (!is_enabled() || num_threads == 0) {
+        return;
+    }
+    const size_t node = get_cpu_nodes()[thread_index * num_nodes() / num_threads];
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : get_topology()[node]) {
+        CPU_SET(cpu, &cpu_set);
+    }
+    pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+#endif
+}
+
+void interleave([[maybe_unused]] void* ptr, [[maybe_unused]] size_t size)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    if (!is_enabled()) {
+        return;
+    }
+    // From linux/mempolicy.h, to avoid depending on libnuma.
+    constexpr int MPOL_INTERLEAVE = 3;
+    constexpr unsigned MPOL_MF_MOVE = 1 << 1;
+
+    // mbind works on whole pages, so only the pages entirely inside the buffer are interleaved.
+    const auto page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    const auto begin = (reinterpret_cast<uintptr_t>(ptr) + page_size - 1) & ~(page_size - 1);
+    const auto end = (reinterpret_cast<uintptr_t>(ptr) + size) & ~(page_size - 1);
+    if (end <= begin) {
+        return;
+    }
+
+    constexpr size_t BITS_PER_WORD = 8 * sizeof(unsigned long);
+    const auto& topology = get_topology();
+    std::vector<unsigned long> node_mask(topology.size() / BITS_PER_WORD + 1, 0);
+    for (const auto node : get_cpu_nodes()) {
+        node_mask[node / BITS_PER_WORD] |= 1UL << (node % BITS_PER_WORD);
+    }
+    // Best effort: on failure the pages simply keep the default first-touch placement.
+    syscall(SYS_mbind,
+            reinterpret_cast<void*>(begin),
+            end - begin,
+            MPOL_INTERLEAVE,
+            node_mask.data(),
+            node_mask.size() * BITS_PER_WORD + 1,
+            MPOL_MF_MOVE);
+#endif
+}
+
+} // namespace barretenberg::numa
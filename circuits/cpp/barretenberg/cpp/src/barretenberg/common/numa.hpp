@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+
+/**
+ * Opt-in NUMA placement for multi-socket hosts.
+ *
+ * By default every large buffer lands on the node of the thread that first touches it, which for slabs and the SRS is
+ * a single thread, so the workers on every other node read it remotely. In NUMA mode:
+ * - parallel_for workers are pinned to the cpus of one node each, spread evenly across nodes;
+ * - large slabs from get_mem_slab (polynomials, the prover SRS, pippenger scratch space) are interleaved page by page
+ *   across nodes, so every node serves an equal share of their bandwidth.
+ *
+ * Enable it with `numa::enable()` or by setting BB_NUMA=1, before the first parallel_for (workers are pinned when the
+ * thread pool starts). It is a no-op on single node hosts and outside Linux.
+ */
+namespace barretenberg::numa {
+
+void enable(bool enabled = true);
+
+bool is_enabled();
+
+size_t num_nodes();
+
+/**
+ * Pins the calling thread to the cpus of the node owning `thread_index`, when threads [0, num_threads) are divided
+ * into equal contiguous blocks per node.
+ */
+void pin_thread(size_t thread_index, size_t num_threads);
+
+/**
+ * Interleaves the pages of the given buffer across all nodes, moving any pages already faulted in.
+ */
+void interleave(void* ptr, size_t size);
+
+} // namespace barretenberg::numa
@@ -0,0 +1,36 @@
+#include "numa.hpp"
+#include "barretenberg/env/hardware_concurrency.hpp"
+#include "mem.hpp"
+#include <gtest/gtest.h>
+#include <set>
+
+TEST(numa, TopologyCoversEveryCpuOnce)
+{
+    auto topology = env_numa_topology();
+    ASSERT_FALSE(topology.empty());
+    std::set<uint32_t> cpus;
+    size_t num_cpus = 0;
+    for (const auto& node : topology) {
+        cpus.insert(node.begin(), node.end());
+        num_cpus += node.size();
+    }
+    EXPECT_EQ(cpus.size(), num_cpus);
+    EXPECT_GE(num_cpus, 1UL);
+    EXPECT_GE(barretenberg::numa::num_nodes(), 1UL);
+}
+
+TEST(numa, InterleavePreservesContents)
+{
+    constexpr size_t size = 4 * 1024 * 1024;
+    auto* buffer = static_cast<uint8_t*>(aligned_alloc(32, size));
+    for (size_t i = 0; i < size; ++i) {
+        buffer[i] = static_cast<uint8_t>(i * 7);
+    }
+    barretenberg::numa::enable();
+    barretenberg::numa::interleave(buffer, size);
+    barretenberg::numa::enable(false);
+    for (size_t i = 0; i < size; ++i) {
+        ASSERT_EQ(buffer[i], static_cast<uint8_t>(i * 7));
+    }
+    aligned_free(buffer);
+}
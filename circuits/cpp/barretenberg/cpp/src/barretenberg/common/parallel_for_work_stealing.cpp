@@ -0,0 +1,313 @@
+#include "numa.hpp"
+#include "thread.hpp"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace thread_detail {
+
+struct task_state {
+    std::function<void()> func;
+    std::atomic<bool> claimed = false;
+    std::atomic<bool> done = false;
+    std::exception_ptr exception;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    // Runs the task unless another thread already has. Returns whether this call ran it.
+    bool try_run()
+    {
+        if (claimed.exchange(true)) {
+            return false;
+        }
+        try {
+            func();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        func = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            done = true;
+        }
+        condition.notify_all();
+        return true;
+    }
+};
+
+} // namespace thread_detail
+
+namespace {
+
+constexpr size_t EXTERNAL_THREAD = std::numeric_limits<size_t>::max();
+
+// Index of the calling thread's deque in the pool, or EXTERNAL_THREAD for threads the pool did not create.
+thread_local size_t current_queue_index = EXTERNAL_THREAD;
+
+class WorkStealingPool {
+  public:
+    WorkStealingPool(size_t num_workers);
+    WorkStealingPool(const WorkStealingPool& other) = delete;
+    WorkStealingPool(WorkStealingPool&& other) = delete;
+    ~WorkStealingPool();
+
+    WorkStealingPool& operator=(const WorkStealingPool& other) = delete;
+    WorkStealingPool& operator=(WorkStealingPool&& other) = delete;
+
+    // Number of threads that can make progress on work, including the calling thread.
+    size_t num_threads() const { return workers.size() + 1; }
+
+    void push(std::function<void()> task)
+    {
+        auto& queue = *queues[own_queue_index()];
+        {
+            std::unique_lock<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        num_queued++;
+        {
+            std::unique_lock<std::mutex> lock(sleep_mutex);
+        }
+        sleep_condition.notify_one();
+    }
+
+    /**
+     * Runs one queued task, if any can be found. Threads take the newest task from their own deque (it is most likely
+     * to be hot in cache, and is typically the inner loop they just spawned) and steal the oldest from others.
+     */
+    bool try_run_one()
+    {
+        const size_t own_index = own_queue_index();
+        std::function<void()> task;
+        if (!pop(own_index, task, true)) {
+            for (size_t i = 1; i < queues.size(); ++i) {
+                if (pop((own_index + i) % queues.size(), task, false)) {
+                    break;
+                }
+            }
+        }
+        if (!task) {
+            return false;
+        }
+        task();
+        return true;
+    }
+
+  private:
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    // One deque per worker, plus a shared one for threads outside the pool.
+    std::vector<std::unique_ptr<Queue>> queues;
+    std::vector<std::thread> workers;
+    std::atomic<size_t> num_queued = 0;
+    std::mutex sleep_mutex;
+    std::condition_variable sleep_condition;
+    bool stop = false;
+
+    size_t own_queue_index() const
+    {
+        return current_queue_index == EXTERNAL_THREAD ? workers.size() : current_queue_index;
+    }
+
+    bool pop(size_t queue_index, std::function<void()>& task, bool from_back)
+    {
+        auto& queue = *queues[queue_index];
+        std::unique_lock<std::mutex> lock(queue.mutex);
+        if (queue.tasks.empty()) {
+            return false;
+        }
+        if (from_back) {
+            task = std::move(queue.tasks.back());
+            queue.tasks.pop_back();
+        } else {
+            task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+        }
+        num_queued--;
+        return true;
+    }
+
+    void worker_loop(size_t thread_index, size_t num_threads);
+};
+
+WorkStealingPool::WorkStealingPool(size_t num_workers)
+{
+    queues.reserve(num_workers + 1);
+    for (size_t i = 0; i < num_workers + 1; ++i) {
+        queues.push_back(std::make_unique<Queue>());
+    }
+    workers.reserve(num_workers);
+    for (size_t i = 0; i < num_workers; ++i) {
+        workers.emplace_back(&WorkStealingPool::worker_loop, this, i, num_workers + 1);
+    }
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+    {
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        stop = true;
+    }
+    sleep_condition.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void WorkStealingPool::worker_loop(size_t thread_index, size_t num_threads)
+{
+    current_queue_index = thread_index;
+    // The calling thread counts as thread 0, and stays wherever its owner put it.
+    barretenberg::numa::pin_thread(thread_index + 1, num_threads);
+    while (true) {
+        if (try_run_one()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex);
+        sleep_condition.wait(lock, [this] { return num_queued > 0 || stop; });
+        if (stop) {
+            break;
+        }
+    }
+}
+
+WorkStealingPool& get_pool()
+{
+    static WorkStealingPool pool(get_num_cpus() - 1);
+    return pool;
+}
+
+/**
+ * The shared state of one parallel_for call. Iterations are claimed from an atomic counter by the calling thread and
+ * by any helper tasks that get picked up by other threads, so no iteration is ever stuck behind a busy thread's queue.
+ */
+struct ParallelJob {
+    ParallelJob(size_t num_iterations, const std::function<void(size_t)>& func)
+        : num_iterations(num_iterations)
+        , func(func)
+    {}
+
+    const size_t num_iterations;
+    // Only dereferenced for claimed iterations, all of which complete before parallel_for returns.
+    const std::function<void(size_t)>& func;
+    std::atomic<size_t> next_iteration = 0;
+    std::atomic<size_t> iterations_completed = 0;
+    std::exception_ptr exception;
+    std::mutex mutex;
+    std::condition_variable condition;
+
+    bool is_done() const { return iterations_completed == num_iterations; }
+
+    void do_iterations()
+    {
+        size_t iteration = 0;
+        while ((iteration = next_iteration.fetch_add(1)) < num_iterations) {
+            try {
+                func(iteration);
+            } catch (...) {
+                std::unique_lock<std::mutex> lock(mutex);
+                if (!exception) {
+                    exception = std::current_exception();
+                }
+            }
+            if (++iterations_completed == num_iterations) {
+                {
+                    std::unique_lock<std::mutex> lock(mutex);
+                }
+                condition.notify_all();
+            }
+        }
+    }
+};
+
+} // namespace
+
+bool task_handle::is_done() const
+{
+    return !state_ || state_->done;
+}
+
+void task_handle::wait()
+{
+    if (!state_) {
+        return;
+    }
+    // If no thread has started the task yet, run it here. Otherwise help with other work until it completes.
+    if (!state_->try_run()) {
+#ifndef NO_MULTITHREADING
+        while (!state_->done && get_pool().try_run_one()) {
+        }
+#endif
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        state_->condition.wait(lock, [this] { return state_->done.load(); });
+    }
+    if (state_->exception) {
+        std::rethrow_exception(state_->exception);
+    }
+}
+
+task_handle spawn(std::function<void()> func)
+{
+    auto state = std::make_shared<thread_detail::task_state>();
+    state->func = std::move(func);
+#ifdef NO_MULTITHREADING
+    state->try_run();
+#else
+    auto& pool = get_pool();
+    if (pool.num_threads() == 1) {
+        state->try_run();
+    } else {
+        pool.push([state] { state->try_run(); });
+    }
+#endif
+    return task_handle(std::move(state));
+}
+
+/**
+ * A persistent pool where every worker owns a deque of tasks, and idle workers steal from the others. A parallel_for
+ * queues one helper task per other thread and then works through the iterations itself. When it runs out of
+ * iterations it runs other queued tasks while waiting for the remaining iterations to complete, rather than blocking.
+ * This makes nested calls safe: a parallel_for issued from inside another one queues its helpers on the calling
+ * worker's deque, where idle threads can steal them, and no thread ever sleeps while it has work it could do.
+ */
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func)
+{
+    if (num_iterations == 0) {
+        return;
+    }
+    auto& pool = get_pool();
+    const size_t num_helpers = std::min(pool.num_threads(), num_iterations) - 1;
+    if (num_helpers == 0) {
+        for (size_t i = 0; i < num_iterations; ++i) {
+            func(i);
+        }
+        return;
+    }
+
+    auto job = std::make_shared<ParallelJob>(num_iterations, func);
+    for (size_t i = 0; i < num_helpers; ++i) {
+        pool.push([job] { job->do_iterations(); });
+    }
+    job->do_iterations();
+
+    while (!job->is_done() && pool.try_run_one()) {
+    }
+    {
+        std::unique_lock<std::mutex> lock(job->mutex);
+        job->condition.wait(lock, [&job] { return job->is_done(); });
+    }
+    if (job->exception) {
+        std::rethrow_exception(job->exception);
+    }
+}
@@ -1,4 +1,5 @@
 #include "slab_allocator.hpp"
+#include "numa.hpp"
 #include <barretenberg/common/assert.hpp>
 #include <barretenberg/common/log.hpp>
 #include <barretenberg/common/mem.hpp>
@@ -23,6 +24,18 @@ bool allocator_destroyed = false;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
 std::unordered_map<void*, std::shared_ptr<void>> manual_slabs;
 
+// Slabs at least this large are interleaved across nodes in NUMA mode. Smaller ones are not worth the syscall.
+constexpr size_t NUMA_INTERLEAVE_THRESHOLD = 1024 * 1024;
+
+void* numa_aligned_alloc(size_t size)
+{
+    void* ptr = aligned_alloc(32, size);
+    if (size >= NUMA_INTERLEAVE_THRESHOLD) {
+        barretenberg::numa::interleave(ptr, size);
+    }
+    return ptr;
+}
+
 template <typename... Args> inline void dbg_info(Args... args)
 {
 #if LOGGING == 1
@@ -127,7 +140,7 @@ void SlabAllocator::init(size_t circuit_size_hint)
     for (auto& e : prealloc_num) {
         for (size_t i = 0; i < e.second; ++i) {
             auto size = e.first;
-            memory_store[size].push_back(aligned_alloc(32, size));
+            memory_store[size].push_back(numa_aligned_alloc(size));
             dbg_info("Allocated memory slab of size: ", size, " total: ", get_total_size());
         }
     }
@@ -175,7 +188,7 @@ std::shared_ptr<void> SlabAllocator::get(size_t req_size)
         dbg_info("WARNING: Allocating unmanaged memory slab of size: ", req_size);
     }
     if (req_size % 32 == 0) {
-        return { aligned_alloc(32, req_size), aligned_free };
+        return { numa_aligned_alloc(req_size), aligned_free };
     }
     // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
     return { malloc(req_size), free };
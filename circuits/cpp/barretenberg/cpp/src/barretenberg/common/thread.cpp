@@ -1,5 +1,6 @@
 #include "thread.hpp"
 #include "log.hpp"
+#include <algorithm>
 
 /**
  * There's a lot to talk about here. To bring threading to WASM, parallel_for was written to replace the OpenMP loops
@@ -34,6 +35,11 @@
  *
  * UPDATE!: Interestingly "atomic_pool" performs worse than "mutex_pool" for some e.g. proving key construction.
  * Haven't done deeper analysis. Defaulting to mutex_pool.
+ *
+ * UPDATE!: None of the pools above can be re-entered. A parallel_for called from inside another one would either
+ * clobber the running loop (the pools) or spawn a full set of threads per outer iteration (spawning). We now default
+ * to "work_stealing", a persistent pool with per-thread deques where waiting threads run other queued work. It supports
+ * nested parallel_for, and is also used to implement `spawn` and `parallel_for_range`.
  */
 
 // 64 core aws r5.
@@ -68,6 +74,8 @@ void parallel_for_atomic_pool(size_t num_iterations, const std::function<void(si
 
 void parallel_for_mutex_pool(size_t num_iterations, const std::function<void(size_t)>& func);
 
+void parallel_for_work_stealing(size_t num_iterations, const std::function<void(size_t)>& func);
+
 void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func)
 {
 #ifdef NO_MULTITHREADING
@@ -81,8 +89,32 @@ void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func
     // parallel_for_spawning(num_iterations, func);
     // parallel_for_moody(num_iterations, func);
     // parallel_for_atomic_pool(num_iterations, func);
-    parallel_for_mutex_pool(num_iterations, func);
+    // parallel_for_mutex_pool(num_iterations, func);
     // parallel_for_queued(num_iterations, func);
+    parallel_for_work_stealing(num_iterations, func);
 #endif
 #endif
 }
+
+void parallel_for_range(size_t num_points,
+                        const std::function<void(size_t start, size_t end)>& func,
+                        size_t grain_size)
+{
+    if (num_points == 0) {
+        return;
+    }
+    grain_size = std::max(grain_size, size_t(1));
+    const size_t num_chunks = std::min(get_num_cpus(), std::max(num_points / grain_size, size_t(1)));
+    if (num_chunks == 1) {
+        func(0, num_points);
+        return;
+    }
+    // Spread the remainder over the first chunks, so every chunk holds at least grain_size points
+    const size_t chunk_size = num_points / num_chunks;
+    const size_t remainder = num_points % num_chunks;
+    parallel_for(num_chunks, [&](size_t chunk_index) {
+        const size_t start = chunk_index * chunk_size + std::min(chunk_index, remainder);
+        const size_t end = start + chunk_size + (chunk_index < remainder ? 1 : 0);
+        func(start, end);
+    });
+}
@@ -3,6 +3,7 @@
 #include <barretenberg/env/hardware_concurrency.hpp>
 #include <barretenberg/numeric/bitop/get_msb.hpp>
 #include <functional>
+#include <memory>
 #include <thread>
 #include <vector>
 
@@ -21,4 +22,40 @@ inline size_t get_num_cpus_pow2()
     return static_cast<size_t>(1ULL << numeric::get_msb(get_num_cpus()));
 }
 
-void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
\ No newline at end of file
+void parallel_for(size_t num_iterations, const std::function<void(size_t)>& func);
+
+/**
+ * @brief Split the range [0, num_points) into contiguous chunks of at least `grain_size` points and process them in
+ * parallel. `func(start, end)` is called once per chunk. Safe to call from within a parallel_for.
+ */
+void parallel_for_range(size_t num_points,
+                        const std::function<void(size_t start, size_t end)>& func,
+                        size_t grain_size = 1);
+
+namespace thread_detail {
+struct task_state;
+}
+
+/**
+ * @brief Handle to a task started with `spawn`. Waiting on it runs other queued work instead of blocking, so handles
+ * can be waited on from inside tasks and parallel loops.
+ */
+class task_handle {
+  public:
+    task_handle() = default;
+    explicit task_handle(std::shared_ptr<thread_detail::task_state> state)
+        : state_(std::move(state))
+    {}
+
+    bool is_done() const;
+    // Waits for the task to complete, rethrowing any exception it threw.
+    void wait();
+
+  private:
+    std::shared_ptr<thread_detail::task_state> state_;
+};
+
+/**
+ * @brief Run `func` asynchronously on the thread pool.
+ */
+task_handle spawn(std::function<void()> func);
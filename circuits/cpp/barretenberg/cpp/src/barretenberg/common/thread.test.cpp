@@ -0,0 +1,86 @@
+#include "thread.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <vector>
+
+TEST(thread, ParallelForRunsEveryIterationOnce)
+{
+    constexpr size_t num_iterations = 1000;
+    std::vector<std::atomic<size_t>> counts(num_iterations);
+    parallel_for(num_iterations, [&](size_t i) { counts[i]++; });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1UL);
+    }
+}
+
+TEST(thread, NestedParallelFor)
+{
+    constexpr size_t num_outer = 16;
+    constexpr size_t num_inner = 256;
+    std::vector<std::atomic<size_t>> counts(num_outer * num_inner);
+    parallel_for(num_outer, [&](size_t i) {
+        parallel_for(num_inner, [&](size_t j) { counts[i * num_inner + j]++; });
+    });
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1UL);
+    }
+}
+
+TEST(thread, ParallelForRangeRespectsGrainSize)
+{
+    constexpr size_t num_points = 1001;
+    constexpr size_t grain_size = 100;
+    std::vector<std::atomic<size_t>> counts(num_points);
+    std::atomic<size_t> smallest_chunk = num_points;
+    parallel_for_range(
+        num_points,
+        [&](size_t start, size_t end) {
+            size_t chunk = end - start;
+            size_t current = smallest_chunk;
+            while (chunk < current && !smallest_chunk.compare_exchange_weak(current, chunk)) {
+            }
+            for (size_t i = start; i < end; ++i) {
+                counts[i]++;
+            }
+        },
+        grain_size);
+    for (auto& count : counts) {
+        EXPECT_EQ(count, 1UL);
+    }
+    EXPECT_GE(smallest_chunk, grain_size);
+}
+
+TEST(thread, SpawnAndWait)
+{
+    std::vector<size_t> results(8);
+    std::vector<task_handle> handles;
+    for (size_t i = 0; i < results.size(); ++i) {
+        handles.push_back(spawn([&results, i] {
+            // Spawned tasks may run their own parallel loops.
+            std::atomic<size_t> sum = 0;
+            parallel_for(100, [&](size_t j) { sum += j; });
+            results[i] = sum + i;
+        }));
+    }
+    for (auto& handle : handles) {
+        handle.wait();
+        EXPECT_TRUE(handle.is_done());
+    }
+    for (size_t i = 0; i < results.size(); ++i) {
+        EXPECT_EQ(results[i], 4950 + i);
+    }
+}
+
+TEST(thread, ExceptionsPropagateToCaller)
+{
+    EXPECT_THROW(parallel_for(64,
+                              [](size_t i) {
+                                  if (i == 17) {
+                                      throw std::runtime_error("iteration failed");
+                                  }
+                              }),
+                 std::runtime_error);
+    auto handle = spawn([] { throw std::runtime_error("task failed"); });
+    EXPECT_THROW(handle.wait(), std::runtime_error);
+}
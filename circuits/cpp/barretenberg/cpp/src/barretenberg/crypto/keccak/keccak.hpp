@@ -31,6 +31,23 @@ void ethash_keccakf1600(uint64_t state[25]) NOEXCEPT;
 
 struct keccak256 ethash_keccak256(const uint8_t* data, size_t size) NOEXCEPT;
 
+/**
+ * Keccak-256 of many independent messages at once.
+ *
+ * The permutation is run on several messages side by side, one per 64-bit SIMD lane: eight at a time with AVX-512,
+ * four at a time with AVX2. Messages of different lengths can share a batch, though a lane whose message is done idles
+ * until the longest in its group is. Messages left over, and every message on other CPUs, go through ethash_keccak256.
+ *
+ * @param data          The messages, data[i] pointing to the sizes[i] bytes of message i.
+ * @param sizes         The message sizes in bytes.
+ * @param num_messages  The number of messages.
+ * @param out           Receives the num_messages hashes, in order.
+ */
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_messages,
+                            struct keccak256* out) NOEXCEPT;
+
 struct keccak256 hash_field_elements(const uint64_t* limbs, size_t num_elements);
 
 struct keccak256 hash_field_element(const uint64_t* limb);
@@ -0,0 +1,236 @@
+#include "keccak.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) && !defined(DISABLE_SHENANIGANS)
+#include <immintrin.h>
+#define BBERG_KECCAK_SIMD 1
+#else
+#define BBERG_KECCAK_SIMD 0
+#endif
+
+namespace {
+
+// Keccak-256 absorbs 136 bytes (17 words) of message per permutation
+constexpr size_t RATE = 136;
+constexpr size_t RATE_WORDS = RATE / 8;
+
+uint64_t to_le64(uint64_t word)
+{
+    if constexpr (std::endian::native == std::endian::big) {
+        return __builtin_bswap64(word);
+    }
+    return word;
+}
+
+uint64_t load_le(const uint8_t* bytes)
+{
+    uint64_t word;
+    std::memcpy(&word, bytes, sizeof(word));
+    return to_le64(word);
+}
+
+#if BBERG_KECCAK_SIMD
+#define BBERG_AVX2_TARGET __attribute__((target("avx2")))
+#define BBERG_AVX512_TARGET __attribute__((target("avx512f")))
+
+/**
+ * Whether the CPU has AVX2 and AVX-512, each checked once. Setting the environment variable BB_NO_SIMD forces the
+ * scalar code path.
+ */
+bool has_avx2()
+{
+    static const bool supported = std::getenv("BB_NO_SIMD") == nullptr && __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+bool has_avx512()
+{
+    static const bool supported = std::getenv("BB_NO_SIMD") == nullptr && __builtin_cpu_supports("avx512f");
+    return supported;
+}
+
+constexpr std::array<uint64_t, 24> round_constants{
+    0x0000000000000001, 0x0000000000008082, 0x800000000000808a, 0x8000000080008000, 0x000000000000808b,
+    0x0000000080000001, 0x8000000080008081, 0x8000000000008009, 0x000000000000008a, 0x0000000000000088,
+    0x0000000080008009, 0x000000008000000a, 0x000000008000808b, 0x800000000000008b, 0x8000000000008089,
+    0x8000000000008003, 0x8000000000008002, 0x8000000000000080, 0x000000000000800a, 0x800000008000000a,
+    0x8000000080008081, 0x8000000000008080, 0x0000000080000001, 0x8000000080008008,
+};
+
+// Word x + 5y of the state is rotated left by ROTATIONS[x + 5y], and moved to word PERMUTED[x + 5y] = y + 5(2x + 3y)
+constexpr std::array<int, 25> ROTATIONS{ 0,  1,  62, 28, 27, 36, 44, 6,  55, 20, 3,  10, 43,
+                                         25, 39, 41, 45, 15, 21, 8,  18, 2,  61, 56, 14 };
+constexpr std::array<size_t, 25> PERMUTED{ 0,  10, 20, 5,  15, 16, 1,  11, 21, 6, 7,  17, 2,
+                                           12, 22, 23, 8,  18, 3,  13, 14, 24, 9, 19, 4 };
+
+BBERG_AVX2_TARGET inline __m256i rol_x4(__m256i x, int shift)
+{
+    return _mm256_or_si256(_mm256_slli_epi64(x, shift), _mm256_srli_epi64(x, 64 - shift));
+}
+
+/**
+ * Keccak-f[1600] on four states, one per 64-bit lane. Word i of lane l is states[4 * i + l].
+ */
+BBERG_AVX2_TARGET void keccakf1600_x4(uint64_t* states)
+{
+    __m256i a[25];
+    for (size_t i = 0; i < 25; ++i) {
+        a[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(states + 4 * i));
+    }
+    for (size_t round = 0; round < 24; ++round) {
+        __m256i c[5];
+        for (size_t x = 0; x < 5; ++x) {
+            const __m256i c01 = _mm256_xor_si256(a[x], a[x + 5]);
+            const __m256i c23 = _mm256_xor_si256(a[x + 10], a[x + 15]);
+            c[x] = _mm256_xor_si256(_mm256_xor_si256(c01, c23), a[x + 20]);
+        }
+        __m256i d[5];
+        for (size_t x = 0; x < 5; ++x) {
+            d[x] = _mm256_xor_si256(c[(x + 4) % 5], rol_x4(c[(x + 1) % 5], 1));
+        }
+        __m256i b[25];
+#pragma GCC unroll 25
+        for (size_t i = 0; i < 25; ++i) {
+            b[PERMUTED[i]] = rol_x4(_mm256_xor_si256(a[i], d[i % 5]), ROTATIONS[i]);
+        }
+        for (size_t y = 0; y < 25; y += 5) {
+            for (size_t x = 0; x < 5; ++x) {
+                a[y + x] = _mm256_xor_si256(b[y + x], _mm256_andnot_si256(b[y + (x + 1) % 5], b[y + (x + 2) % 5]));
+            }
+        }
+        a[0] = _mm256_xor_si256(a[0], _mm256_set1_epi64x(static_cast<long long>(round_constants[round])));
+    }
+    for (size_t i = 0; i < 25; ++i) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(states + 4 * i), a[i]);
+    }
+}
+
+// GCC's AVX-512 intrinsics start from _mm512_undefined_epi32(), which trips its own uninitialized warnings.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+/**
+ * As keccakf1600_x4 but for eight states, with word i of lane l at states[8 * i + l]. AVX-512 has 64-bit rotates, and
+ * the three-input logic instruction does the five-way xors and the chi step's a ^ (~b & c) in few instructions.
+ */
+BBERG_AVX512_TARGET void keccakf1600_x8(uint64_t* states)
+{
+    constexpr int XOR3 = 0x96;
+    constexpr int XOR_ANDNOT = 0xD2;
+    __m512i a[25];
+    for (size_t i = 0; i < 25; ++i) {
+        a[i] = _mm512_loadu_si512(states + 8 * i);
+    }
+    for (size_t round = 0; round < 24; ++round) {
+        __m512i c[5];
+        for (size_t x = 0; x < 5; ++x) {
+            c[x] = _mm512_ternarylogic_epi64(
+                _mm512_ternarylogic_epi64(a[x], a[x + 5], a[x + 10], XOR3), a[x + 15], a[x + 20], XOR3);
+        }
+        __m512i rotated[5];
+        for (size_t x = 0; x < 5; ++x) {
+            rotated[x] = _mm512_rolv_epi64(c[x], _mm512_set1_epi64(1));
+        }
+        __m512i b[25];
+#pragma GCC unroll 25
+        for (size_t i = 0; i < 25; ++i) {
+            const __m512i theta = _mm512_ternarylogic_epi64(a[i], c[(i + 4) % 5], rotated[(i + 1) % 5], XOR3);
+            b[PERMUTED[i]] = _mm512_rolv_epi64(theta, _mm512_set1_epi64(ROTATIONS[i]));
+        }
+        for (size_t y = 0; y < 25; y += 5) {
+            for (size_t x = 0; x < 5; ++x) {
+                a[y + x] = _mm512_ternarylogic_epi64(b[y + x], b[y + (x + 1) % 5], b[y + (x + 2) % 5], XOR_ANDNOT);
+            }
+        }
+        a[0] = _mm512_xor_si512(a[0], _mm512_set1_epi64(static_cast<long long>(round_constants[round])));
+    }
+    for (size_t i = 0; i < 25; ++i) {
+        _mm512_storeu_si512(states + 8 * i, a[i]);
+    }
+}
+#pragma GCC diagnostic pop
+
+using lanes_kernel = void (*)(uint64_t* states);
+
+/**
+ * Hashes messages together, at most one per lane, with a kernel that permutes every lane's state. A message's last
+ * block is the padded tail of the message, which may be just the padding. Once a message's blocks run out its lane is
+ * still permuted, but not read again.
+ */
+void keccak256_lanes(const uint8_t* const* data,
+                     const size_t* sizes,
+                     size_t num_messages,
+                     keccak256* out,
+                     size_t lanes,
+                     lanes_kernel kernel)
+{
+    std::vector<uint64_t> states(25 * lanes, 0);
+    std::vector<std::array<uint8_t, RATE>> last_blocks(num_messages);
+    size_t num_blocks = 0;
+    for (size_t lane = 0; lane < num_messages; ++lane) {
+        const size_t tail = sizes[lane] % RATE;
+        last_blocks[lane].fill(0);
+        if (tail > 0) {
+            std::memcpy(&last_blocks[lane][0], data[lane] + sizes[lane] - tail, tail);
+        }
+        last_blocks[lane][tail] ^= 0x01;
+        last_blocks[lane][RATE - 1] ^= 0x80;
+        num_blocks = std::max(num_blocks, sizes[lane] / RATE + 1);
+    }
+    for (size_t i = 0; i < num_blocks; ++i) {
+        for (size_t lane = 0; lane < num_messages; ++lane) {
+            const size_t last_block = sizes[lane] / RATE;
+            if (i <= last_block) {
+                const uint8_t* block = i < last_block ? data[lane] + i * RATE : &last_blocks[lane][0];
+                for (size_t j = 0; j < RATE_WORDS; ++j) {
+                    states[j * lanes + lane] ^= load_le(block + j * 8);
+                }
+            }
+        }
+        kernel(&states[0]);
+        for (size_t lane = 0; lane < num_messages; ++lane) {
+            if (i == sizes[lane] / RATE) {
+                for (size_t j = 0; j < 4; ++j) {
+                    out[lane].word64s[j] = to_le64(states[j * lanes + lane]);
+                }
+            }
+        }
+    }
+}
+#endif
+
+} // namespace
+
+void ethash_keccak256_batch(const uint8_t* const* data,
+                            const size_t* sizes,
+                            size_t num_messages,
+                            struct keccak256* out) NOEXCEPT
+{
+    size_t i = 0;
+#if BBERG_KECCAK_SIMD
+    size_t lanes = 0;
+    lanes_kernel kernel = nullptr;
+    if (has_avx512()) {
+        lanes = 8;
+        kernel = keccakf1600_x8;
+    } else if (has_avx2()) {
+        lanes = 4;
+        kernel = keccakf1600_x4;
+    }
+    if (kernel != nullptr) {
+        // A group that would leave more than half the lanes idle is left to ethash_keccak256
+        for (; i < num_messages && (num_messages - i) * 2 >= lanes; i += lanes) {
+            const size_t group_size = std::min(lanes, num_messages - i);
+            keccak256_lanes(data + i, sizes + i, group_size, out + i, lanes, kernel);
+        }
+    }
+#endif
+    for (; i < num_messages; ++i) {
+        out[i] = ethash_keccak256(data[i], sizes[i]);
+    }
+}
@@ -102,6 +102,46 @@ grumpkin::g1::affine_element commit_native(const std::vector<grumpkin::fq>& inpu
     return grumpkin::g1::affine_element(merkle_damgard_compress(inputs, hash_indices));
 }
 
+std::vector<grumpkin::g1::affine_element> batch_commit_native(const std::vector<std::vector<grumpkin::fq>>& inputs,
+                                                              const size_t hash_index)
+{
+    init();
+    // merkle_damgard_compress absorbs the number of inputs and then the inputs, starting from the IV
+    std::vector<grumpkin::fq> initial_values;
+    std::vector<std::vector<grumpkin::fq>> chain_inputs;
+    for (const auto& commit_inputs : inputs) {
+        if (commit_inputs.empty()) {
+            continue;
+        }
+        initial_values.push_back(pedersen_iv_table[hash_index].x);
+        chain_inputs.emplace_back();
+        chain_inputs.back().reserve(commit_inputs.size() + 1);
+        chain_inputs.back().emplace_back(commit_inputs.size());
+        chain_inputs.back().insert(chain_inputs.back().end(), commit_inputs.begin(), commit_inputs.end());
+    }
+    const auto points = batch_hash_chains(initial_values, chain_inputs);
+
+    std::vector<grumpkin::g1::affine_element> results;
+    results.reserve(inputs.size());
+    auto point = points.begin();
+    for (const auto& commit_inputs : inputs) {
+        results.emplace_back(commit_inputs.empty() ? commit_native(commit_inputs, hash_index) : *point++);
+    }
+    return results;
+}
+
+std::vector<grumpkin::fq> batch_compress_native(const std::vector<std::vector<grumpkin::fq>>& inputs,
+                                                const size_t hash_index)
+{
+    const auto points = batch_commit_native(inputs, hash_index);
+    std::vector<grumpkin::fq> results;
+    results.reserve(points.size());
+    for (const auto& point : points) {
+        results.emplace_back(point.x);
+    }
+    return results;
+}
+
 grumpkin::fq compress_native(const std::vector<grumpkin::fq>& inputs, const size_t hash_index)
 {
     return commit_native(inputs, hash_index).x;
@@ -27,6 +27,15 @@ grumpkin::g1::affine_element commit_native(const std::vector<grumpkin::fq>& inpu
 grumpkin::g1::affine_element commit_native(const std::vector<grumpkin::fq>& inputs,
                                            const std::vector<size_t>& hash_indices);
 
+/**
+ * Commit to (or compress) many independent input vectors at once, with the batched hashing of
+ * pedersen_hash::lookup::batch_hash_chains. Results match commit_native and compress_native on each input vector.
+ */
+std::vector<grumpkin::g1::affine_element> batch_commit_native(const std::vector<std::vector<grumpkin::fq>>& inputs,
+                                                              const size_t hash_index = 0);
+std::vector<grumpkin::fq> batch_compress_native(const std::vector<std::vector<grumpkin::fq>>& inputs,
+                                                const size_t hash_index = 0);
+
 } // namespace lookup
 } // namespace pedersen_commitment
 } // namespace crypto
\ No newline at end of file
@@ -258,3 +258,56 @@ TEST(pedersen_lookup, merkle_damgard_tree_compress)
                              compute_expected(fq(m), (crypto::pedersen_hash::lookup::NUM_PEDERSEN_TABLES / 2)))
                   .x);
 }
+
+TEST(pedersen_lookup, batch_hash_pair)
+{
+    typedef grumpkin::fq fq;
+
+    // Enough pairs to be split across threads, including a repeated pair and a zero input
+    const size_t num_pairs = 100;
+    std::vector<fq> left;
+    std::vector<fq> right;
+    for (size_t i = 0; i < num_pairs; i++) {
+        left.push_back(engine.get_random_uint256());
+        right.push_back(engine.get_random_uint256());
+    }
+    left[1] = left[0];
+    right[1] = right[0];
+    left[2] = fq::zero();
+
+    const auto results = crypto::pedersen_hash::lookup::batch_hash_pair(left, right);
+
+    ASSERT_EQ(results.size(), num_pairs);
+    for (size_t i = 0; i < num_pairs; i++) {
+        EXPECT_EQ(results[i], crypto::pedersen_hash::lookup::hash_pair(left[i], right[i]));
+    }
+}
+
+TEST(pedersen_lookup, batch_hash_multiple_and_commit)
+{
+    typedef grumpkin::fq fq;
+
+    // Input vectors of different lengths, including an empty one
+    std::vector<std::vector<fq>> inputs;
+    for (size_t length : { 2UL, 0UL, 1UL, 5UL, 2UL, 3UL }) {
+        std::vector<fq> hash_inputs;
+        for (size_t i = 0; i < length; i++) {
+            hash_inputs.push_back(engine.get_random_uint256());
+        }
+        inputs.push_back(hash_inputs);
+    }
+    const size_t hash_index = 3;
+
+    const auto hashes = crypto::pedersen_hash::lookup::batch_hash_multiple(inputs, hash_index);
+    const auto commitments = crypto::pedersen_commitment::lookup::batch_commit_native(inputs, hash_index);
+    const auto compressions = crypto::pedersen_commitment::lookup::batch_compress_native(inputs, hash_index);
+
+    ASSERT_EQ(hashes.size(), inputs.size());
+    ASSERT_EQ(commitments.size(), inputs.size());
+    ASSERT_EQ(compressions.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++) {
+        EXPECT_EQ(hashes[i], crypto::pedersen_hash::lookup::hash_multiple(inputs[i], hash_index));
+        EXPECT_EQ(commitments[i], crypto::pedersen_commitment::lookup::commit_native(inputs[i], hash_index));
+        EXPECT_EQ(compressions[i], crypto::pedersen_commitment::lookup::compress_native(inputs[i], hash_index));
+    }
+}
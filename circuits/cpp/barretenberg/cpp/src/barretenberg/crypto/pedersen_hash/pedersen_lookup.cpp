@@ -1,8 +1,11 @@
 #include "./pedersen_lookup.hpp"
 
+#include <bit>
 #include <mutex>
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 
 namespace crypto {
 namespace pedersen_hash {
@@ -180,6 +183,167 @@ grumpkin::fq hash_multiple(const std::vector<grumpkin::fq>& inputs, const size_t
     return final_result.x;
 }
 
+namespace {
+constexpr size_t NUM_ROUNDS = NUM_PEDERSEN_TABLES / 2;
+// hash_single sums a point per round into its first accumulator, and one per round but the last into its second
+constexpr size_t POINTS_PER_HASH_SINGLE = 2 * NUM_ROUNDS - 1;
+// The points of a hash_pair, padded with points at infinity so they pair up at every level of the summation tree
+constexpr size_t POINTS_PER_HASH_PAIR = std::bit_ceil(2 * POINTS_PER_HASH_SINGLE);
+// Fewer hashes than this are not worth a thread of their own
+constexpr size_t BATCH_GRAIN_SIZE = 16;
+
+/**
+ * Writes the table points that hash_single(input, parity) sums. The points of its first accumulator are written with
+ * the endomorphism (x, y) -> (beta * x, y) already applied, which hash_single applies to their sum.
+ */
+void get_hash_single_points(const grumpkin::fq& input,
+                            const bool parity,
+                            const grumpkin::fq& beta,
+                            grumpkin::g1::affine_element* points)
+{
+    uint256_t bits(input);
+    constexpr uint64_t table_mask = PEDERSEN_TABLE_SIZE - 1;
+    const size_t table_index_offset = parity ? NUM_ROUNDS : 0;
+    for (size_t i = 0; i < NUM_ROUNDS; ++i) {
+        const uint64_t slice_a = (bits.data[0] & table_mask);
+        bits >>= BITS_PER_TABLE;
+        const uint64_t slice_b = (bits.data[0] & table_mask);
+
+        const size_t index = table_index_offset + i;
+        *points = pedersen_tables[index][static_cast<size_t>(slice_a)];
+        points->x *= beta;
+        ++points;
+        if (i < (NUM_ROUNDS - 1)) {
+            *points = pedersen_tables[index][static_cast<size_t>(slice_b)];
+            ++points;
+        }
+        bits >>= (BITS_PER_TABLE);
+    }
+}
+} // namespace
+
+/**
+ * Computes the points hash_single(left[i], false) + hash_single(right[i], true), whose x coordinates are the
+ * hash_pair results.
+ */
+void batch_hash_pair_points(std::span<const grumpkin::fq> left,
+                            std::span<const grumpkin::fq> right,
+                            std::span<grumpkin::g1::affine_element> points)
+{
+    ASSERT(left.size() == right.size() && left.size() == points.size());
+    init();
+    const grumpkin::fq beta = grumpkin::fq::cube_root_of_unity();
+    parallel_for_range(
+        left.size(),
+        [&](size_t start, size_t end) {
+            const size_t num_hashes = end - start;
+            std::vector<grumpkin::g1::affine_element> summands(num_hashes * POINTS_PER_HASH_PAIR);
+            std::vector<grumpkin::fq> scratch_space(summands.size() / 2);
+            for (size_t i = 0; i < num_hashes; ++i) {
+                auto* hash_summands = &summands[i * POINTS_PER_HASH_PAIR];
+                get_hash_single_points(left[start + i], false, beta, hash_summands);
+                get_hash_single_points(right[start + i], true, beta, hash_summands + POINTS_PER_HASH_SINGLE);
+                for (size_t j = 2 * POINTS_PER_HASH_SINGLE; j < POINTS_PER_HASH_PAIR; ++j) {
+                    hash_summands[j].self_set_infinity();
+                }
+            }
+            // Each level adds adjacent points with one shared inversion, and leaves the sums in the upper half of the
+            // level's points, in the same order. So the upper half is the next level, until one point per hash is left.
+            auto* level = &summands[0];
+            for (size_t num_points = summands.size(); num_points > num_hashes; num_points >>= 1) {
+                barretenberg::scalar_multiplication::add_affine_points_with_edge_cases<curve::Grumpkin>(
+                    level, num_points, &scratch_space[0]);
+                level += num_points >> 1;
+            }
+            std::copy(level, level + num_hashes, &points[start]);
+        },
+        BATCH_GRAIN_SIZE);
+}
+
+std::vector<grumpkin::fq> batch_hash_pair(std::span<const grumpkin::fq> left, std::span<const grumpkin::fq> right)
+{
+    std::vector<grumpkin::g1::affine_element> points(left.size());
+    batch_hash_pair_points(left, right, points);
+    std::vector<grumpkin::fq> results;
+    results.reserve(points.size());
+    for (const auto& point : points) {
+        results.emplace_back(point.x);
+    }
+    return results;
+}
+
+/**
+ * Runs many hash chains side by side. Chain i starts from initial_values[i] and absorbs each of chain_inputs[i] in
+ * turn with hash_pair, and its result is the point of its last hash_pair, which must exist. Each step hashes the next
+ * input of every chain that has one as a single batch.
+ */
+std::vector<grumpkin::g1::affine_element> batch_hash_chains(const std::vector<grumpkin::fq>& initial_values,
+                                                            const std::vector<std::vector<grumpkin::fq>>& chain_inputs)
+{
+    ASSERT(initial_values.size() == chain_inputs.size());
+    const size_t num_chains = chain_inputs.size();
+    size_t num_steps = 0;
+    for (const auto& inputs : chain_inputs) {
+        ASSERT(!inputs.empty());
+        num_steps = std::max(num_steps, inputs.size());
+    }
+
+    std::vector<grumpkin::fq> chain_values(initial_values);
+    std::vector<grumpkin::g1::affine_element> results(num_chains);
+    std::vector<size_t> active_chains;
+    std::vector<grumpkin::fq> left;
+    std::vector<grumpkin::fq> right;
+    std::vector<grumpkin::g1::affine_element> points;
+    for (size_t step = 0; step < num_steps; ++step) {
+        active_chains.clear();
+        left.clear();
+        right.clear();
+        for (size_t i = 0; i < num_chains; ++i) {
+            if (step < chain_inputs[i].size()) {
+                active_chains.push_back(i);
+                left.push_back(chain_values[i]);
+                right.push_back(chain_inputs[i][step]);
+            }
+        }
+        points.resize(active_chains.size());
+        batch_hash_pair_points(left, right, points);
+        for (size_t j = 0; j < active_chains.size(); ++j) {
+            const size_t i = active_chains[j];
+            chain_values[i] = points[j].x;
+            if (step + 1 == chain_inputs[i].size()) {
+                results[i] = points[j];
+            }
+        }
+    }
+    return results;
+}
+
+std::vector<grumpkin::fq> batch_hash_multiple(const std::vector<std::vector<grumpkin::fq>>& inputs,
+                                              const size_t hash_index)
+{
+    init();
+    // hash_multiple absorbs the inputs and then their number, starting from the IV
+    std::vector<grumpkin::fq> initial_values;
+    std::vector<std::vector<grumpkin::fq>> chain_inputs;
+    for (const auto& hash_inputs : inputs) {
+        if (hash_inputs.empty()) {
+            continue;
+        }
+        initial_values.push_back(pedersen_iv_table[hash_index].x);
+        chain_inputs.push_back(hash_inputs);
+        chain_inputs.back().emplace_back(hash_inputs.size());
+    }
+    const auto points = batch_hash_chains(initial_values, chain_inputs);
+
+    std::vector<grumpkin::fq> results;
+    results.reserve(inputs.size());
+    auto point = points.begin();
+    for (const auto& hash_inputs : inputs) {
+        results.emplace_back(hash_inputs.empty() ? hash_multiple(hash_inputs, hash_index) : (point++)->x);
+    }
+    return results;
+}
+
 } // namespace lookup
 } // namespace pedersen_hash
 } // namespace crypto
\ No newline at end of file
@@ -1,9 +1,18 @@
 #include "./sha256.hpp"
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/net.hpp"
+#include <algorithm>
 #include <array>
+#include <cstdlib>
 #include <memory.h>
 
+#if defined(__x86_64__) && !defined(DISABLE_SHENANIGANS)
+#include <immintrin.h>
+#define BBERG_SHA256_SIMD 1
+#else
+#define BBERG_SHA256_SIMD 0
+#endif
+
 namespace sha256 {
 
 namespace {
@@ -108,73 +117,341 @@ std::array<uint32_t, 8> sha256_block(const std::array<uint32_t, 8>& h_init, cons
     return output;
 }
 
-hash sha256_block(const std::vector<uint8_t>& input)
+namespace {
+
+uint32_t read_be32(const uint8_t* bytes)
 {
-    ASSERT(input.size() == 64);
-    std::array<uint32_t, 8> result;
-    prepare_constants(result);
-    std::array<uint32_t, 16> hash_input;
-    memcpy((void*)&hash_input[0], (void*)&input[0], 64);
-    if (is_little_endian()) {
-        for (size_t j = 0; j < hash_input.size(); ++j) {
-            hash_input[j] = __builtin_bswap32(hash_input[j]);
-        }
+    uint32_t word;
+    memcpy((void*)&word, (void*)bytes, 4);
+    return is_little_endian() ? __builtin_bswap32(word) : word;
+}
+
+void write_be32(uint8_t* bytes, uint32_t word)
+{
+    word = is_little_endian() ? __builtin_bswap32(word) : word;
+    memcpy((void*)bytes, (void*)&word, 4);
+}
+
+/**
+ * Appends the 0x80 byte, zeros and the 64-bit bit length, taking the message to a whole number of 64-byte blocks
+ **/
+void append_padding(std::vector<uint8_t>& message)
+{
+    const size_t size = message.size();
+    const uint64_t l = size * 8;
+    message.resize((size + 72) / 64 * 64, 0);
+    message[size] = 0x80;
+    for (size_t i = 0; i < 8; ++i) {
+        message[message.size() - 8 + i] = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
     }
-    result = sha256_block(result, hash_input);
+}
 
-    hash output;
-    memcpy((void*)&output[0], (void*)&result[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
+#if BBERG_SHA256_SIMD
+#define BBERG_SHA_NI_TARGET __attribute__((target("sha,sse4.1")))
+#define BBERG_AVX2_TARGET __attribute__((target("avx2")))
+#define BBERG_AVX512_TARGET __attribute__((target("avx512f")))
+
+/**
+ * Whether the CPU has the SHA extensions, AVX2 and AVX-512, each checked once. Setting the environment variable
+ * BB_NO_SIMD forces the scalar code paths.
+ **/
+bool has_sha_ni()
+{
+    static const bool supported = std::getenv("BB_NO_SIMD") == nullptr && __builtin_cpu_supports("sha");
+    return supported;
+}
+
+bool has_avx2()
+{
+    static const bool supported = std::getenv("BB_NO_SIMD") == nullptr && __builtin_cpu_supports("avx2");
+    return supported;
+}
+
+bool has_avx512()
+{
+    static const bool supported = std::getenv("BB_NO_SIMD") == nullptr && __builtin_cpu_supports("avx512f");
+    return supported;
+}
+
+/**
+ * Compresses num_blocks consecutive blocks of a padded message into state with the SHA extensions, which keep the state
+ * as the word pairs ABEF and CDGH and do two rounds per sha256rnds2
+ **/
+BBERG_SHA_NI_TARGET void compress_blocks_sha_ni(std::array<uint32_t, 8>& state,
+                                                const uint8_t* blocks,
+                                                size_t num_blocks)
+{
+    // Reverses the bytes of each 32-bit word, as the message words are big-endian
+    const __m128i byte_swap = _mm_set_epi64x(0x0c0d0e0f08090a0bLL, 0x0405060700010203LL);
+    __m128i cdab = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0])), 0xB1);
+    __m128i cdgh = _mm_shuffle_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4])), 0x1B);
+    __m128i abef = _mm_alignr_epi8(cdab, cdgh, 8);
+    cdgh = _mm_blend_epi16(cdgh, cdab, 0xF0);
+
+    for (size_t block = 0; block < num_blocks; ++block) {
+        const __m128i abef_in = abef;
+        const __m128i cdgh_in = cdgh;
+        // Message words 4i to 4i + 3 go in w[i % 4], which until then holds the words 16 before them
+        __m128i w[4];
+#pragma GCC unroll 16
+        for (size_t i = 0; i < 16; ++i) {
+            if (i < 4) {
+                w[i] = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + 16 * i)), byte_swap);
+            } else {
+                __m128i next = _mm_sha256msg1_epu32(w[i % 4], w[(i + 1) % 4]);
+                next = _mm_add_epi32(next, _mm_alignr_epi8(w[(i + 3) % 4], w[(i + 2) % 4], 4));
+                w[i % 4] = _mm_sha256msg2_epu32(next, w[(i + 3) % 4]);
+            }
+            const __m128i k = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&round_constants[4 * i]));
+            const __m128i wk = _mm_add_epi32(w[i % 4], k);
+            cdgh = _mm_sha256rnds2_epu32(cdgh, abef, wk);
+            abef = _mm_sha256rnds2_epu32(abef, cdgh, _mm_shuffle_epi32(wk, 0x0E));
         }
+        abef = _mm_add_epi32(abef, abef_in);
+        cdgh = _mm_add_epi32(cdgh, cdgh_in);
+        blocks += 64;
     }
 
-    return output;
+    const __m128i feba = _mm_shuffle_epi32(abef, 0x1B);
+    const __m128i dchg = _mm_shuffle_epi32(cdgh, 0xB1);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), _mm_blend_epi16(feba, dchg, 0xF0));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), _mm_alignr_epi8(dchg, feba, 8));
 }
 
-template <typename ByteContainer> hash sha256(const ByteContainer& input)
+template <int shift> BBERG_AVX2_TARGET inline __m256i ror_x8(__m256i x)
 {
-    std::vector<uint8_t> message_schedule;
+    return _mm256_or_si256(_mm256_srli_epi32(x, shift), _mm256_slli_epi32(x, 32 - shift));
+}
 
-    std::copy(input.begin(), input.end(), std::back_inserter(message_schedule));
-    uint64_t l = message_schedule.size() * 8;
-    message_schedule.push_back(0x80);
+/**
+ * Compresses one block of each of eight messages, one message per 32-bit lane. Word i of lane l is state[8 * i + l],
+ * and likewise for the block, whose words are already in host byte order.
+ **/
+BBERG_AVX2_TARGET void sha256_block_x8(uint32_t* state, const uint32_t* block)
+{
+    __m256i w[64];
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + 8 * i));
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        const __m256i s0 = _mm256_xor_si256(_mm256_xor_si256(ror_x8<7>(w[i - 15]), ror_x8<18>(w[i - 15])),
+                                            _mm256_srli_epi32(w[i - 15], 3));
+        const __m256i s1 = _mm256_xor_si256(_mm256_xor_si256(ror_x8<17>(w[i - 2]), ror_x8<19>(w[i - 2])),
+                                            _mm256_srli_epi32(w[i - 2], 10));
+        w[i] = _mm256_add_epi32(_mm256_add_epi32(w[i - 16], w[i - 7]), _mm256_add_epi32(s0, s1));
+    }
 
-    uint32_t num_zero_bytes = ((448U - (message_schedule.size() << 3U)) & 511U) >> 3U;
+    __m256i v[8];
+    for (size_t i = 0; i < 8; ++i) {
+        v[i] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state + 8 * i));
+    }
+    auto [a, b, c, d, e, f, g, h] = v;
+    for (size_t i = 0; i < 64; ++i) {
+        const __m256i S1 = _mm256_xor_si256(_mm256_xor_si256(ror_x8<6>(e), ror_x8<11>(e)), ror_x8<25>(e));
+        const __m256i ch = _mm256_xor_si256(_mm256_and_si256(e, f), _mm256_andnot_si256(e, g));
+        const __m256i k = _mm256_set1_epi32(static_cast<int>(round_constants[i]));
+        const __m256i temp1 =
+            _mm256_add_epi32(_mm256_add_epi32(_mm256_add_epi32(h, S1), _mm256_add_epi32(ch, k)), w[i]);
+        const __m256i S0 = _mm256_xor_si256(_mm256_xor_si256(ror_x8<2>(a), ror_x8<13>(a)), ror_x8<22>(a));
+        const __m256i maj = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(c, _mm256_or_si256(a, b)));
 
-    for (size_t i = 0; i < num_zero_bytes; ++i) {
-        message_schedule.push_back(0x00);
+        h = g;
+        g = f;
+        f = e;
+        e = _mm256_add_epi32(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm256_add_epi32(temp1, _mm256_add_epi32(S0, maj));
     }
+
+    const __m256i out[8]{ a, b, c, d, e, f, g, h };
     for (size_t i = 0; i < 8; ++i) {
-        uint8_t byte = static_cast<uint8_t>(l >> (uint64_t)(56 - (i * 8)));
-        message_schedule.push_back(byte);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(state + 8 * i), _mm256_add_epi32(v[i], out[i]));
     }
-    std::array<uint32_t, 8> rolling_hash;
-    prepare_constants(rolling_hash);
-    const size_t num_blocks = message_schedule.size() / 64;
+}
+
+// GCC's AVX-512 shift intrinsics start from _mm512_undefined_epi32(), which trips its own uninitialized warnings.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+/**
+ * As sha256_block_x8 but for sixteen messages, with word i of lane l at state[16 * i + l]. The three-input logic
+ * instruction does each of the Boolean functions, and each three-way xor, in one go.
+ **/
+BBERG_AVX512_TARGET void sha256_block_x16(uint32_t* state, const uint32_t* block)
+{
+    constexpr int XOR3 = 0x96;
+    constexpr int CHOOSE = 0xCA;
+    constexpr int MAJORITY = 0xE8;
+    __m512i w[64];
+    for (size_t i = 0; i < 16; ++i) {
+        w[i] = _mm512_loadu_si512(block + 16 * i);
+    }
+    for (size_t i = 16; i < 64; ++i) {
+        const __m512i s0 = _mm512_ternarylogic_epi32(
+            _mm512_ror_epi32(w[i - 15], 7), _mm512_ror_epi32(w[i - 15], 18), _mm512_srli_epi32(w[i - 15], 3), XOR3);
+        const __m512i s1 = _mm512_ternarylogic_epi32(
+            _mm512_ror_epi32(w[i - 2], 17), _mm512_ror_epi32(w[i - 2], 19), _mm512_srli_epi32(w[i - 2], 10), XOR3);
+        w[i] = _mm512_add_epi32(_mm512_add_epi32(w[i - 16], w[i - 7]), _mm512_add_epi32(s0, s1));
+    }
+
+    __m512i v[8];
+    for (size_t i = 0; i < 8; ++i) {
+        v[i] = _mm512_loadu_si512(state + 16 * i);
+    }
+    auto [a, b, c, d, e, f, g, h] = v;
+    for (size_t i = 0; i < 64; ++i) {
+        const __m512i S1 =
+            _mm512_ternarylogic_epi32(_mm512_ror_epi32(e, 6), _mm512_ror_epi32(e, 11), _mm512_ror_epi32(e, 25), XOR3);
+        const __m512i ch = _mm512_ternarylogic_epi32(e, f, g, CHOOSE);
+        const __m512i k = _mm512_set1_epi32(static_cast<int>(round_constants[i]));
+        const __m512i temp1 =
+            _mm512_add_epi32(_mm512_add_epi32(_mm512_add_epi32(h, S1), _mm512_add_epi32(ch, k)), w[i]);
+        const __m512i S0 =
+            _mm512_ternarylogic_epi32(_mm512_ror_epi32(a, 2), _mm512_ror_epi32(a, 13), _mm512_ror_epi32(a, 22), XOR3);
+        const __m512i maj = _mm512_ternarylogic_epi32(a, b, c, MAJORITY);
+
+        h = g;
+        g = f;
+        f = e;
+        e = _mm512_add_epi32(d, temp1);
+        d = c;
+        c = b;
+        b = a;
+        a = _mm512_add_epi32(temp1, _mm512_add_epi32(S0, maj));
+    }
+
+    const __m512i out[8]{ a, b, c, d, e, f, g, h };
+    for (size_t i = 0; i < 8; ++i) {
+        _mm512_storeu_si512(state + 16 * i, _mm512_add_epi32(v[i], out[i]));
+    }
+}
+#pragma GCC diagnostic pop
+#endif
+
+/**
+ * Compresses num_blocks consecutive blocks of a padded message into state, with the SHA extensions if the CPU has them
+ **/
+void compress_blocks(std::array<uint32_t, 8>& state, const uint8_t* blocks, size_t num_blocks)
+{
+#if BBERG_SHA256_SIMD
+    if (has_sha_ni()) {
+        compress_blocks_sha_ni(state, blocks, num_blocks);
+        return;
+    }
+#endif
     for (size_t i = 0; i < num_blocks; ++i) {
         std::array<uint32_t, 16> hash_input;
-        memcpy((void*)&hash_input[0], (void*)&message_schedule[i * 64], 64);
-        if (is_little_endian()) {
-            for (size_t j = 0; j < hash_input.size(); ++j) {
-                hash_input[j] = __builtin_bswap32(hash_input[j]);
-            }
+        for (size_t j = 0; j < 16; ++j) {
+            hash_input[j] = read_be32(blocks + i * 64 + j * 4);
         }
-        rolling_hash = sha256_block(rolling_hash, hash_input);
+        state = sha256_block(state, hash_input);
     }
+}
 
+hash to_hash(const std::array<uint32_t, 8>& state)
+{
     hash output;
-    memcpy((void*)&output[0], (void*)&rolling_hash[0], 32);
-    if (is_little_endian()) {
-        uint32_t* output_uint32 = (uint32_t*)&output[0];
-        for (size_t j = 0; j < 8; ++j) {
-            output_uint32[j] = __builtin_bswap32(output_uint32[j]);
+    for (size_t j = 0; j < 8; ++j) {
+        write_be32(&output[j * 4], state[j]);
+    }
+    return output;
+}
+
+using lanes_kernel = void (*)(uint32_t* state, const uint32_t* block);
+
+/**
+ * Hashes padded messages together, at most one per lane, with a kernel that compresses one block in each lane. Once a
+ * message's blocks run out its lane is still compressed, on stale input, but not read again.
+ **/
+void sha256_lanes(std::span<const std::vector<uint8_t>> padded, hash* outputs, size_t lanes, lanes_kernel kernel)
+{
+    std::vector<uint32_t> state(8 * lanes);
+    std::vector<uint32_t> block(16 * lanes);
+    for (size_t i = 0; i < 8; ++i) {
+        std::fill_n(&state[i * lanes], lanes, init_constants[i]);
+    }
+    size_t num_blocks = 0;
+    for (const auto& message : padded) {
+        num_blocks = std::max(num_blocks, message.size() / 64);
+    }
+    for (size_t i = 0; i < num_blocks; ++i) {
+        for (size_t lane = 0; lane < padded.size(); ++lane) {
+            if (i * 64 < padded[lane].size()) {
+                for (size_t j = 0; j < 16; ++j) {
+                    block[j * lanes + lane] = read_be32(&padded[lane][i * 64 + j * 4]);
+                }
+            }
+        }
+        kernel(&state[0], &block[0]);
+        for (size_t lane = 0; lane < padded.size(); ++lane) {
+            if ((i + 1) * 64 == padded[lane].size()) {
+                for (size_t j = 0; j < 8; ++j) {
+                    write_be32(&outputs[lane][j * 4], state[j * lanes + lane]);
+                }
+            }
         }
     }
+}
 
-    return output;
+} // namespace
+
+hash sha256_block(const std::vector<uint8_t>& input)
+{
+    ASSERT(input.size() == 64);
+    std::array<uint32_t, 8> result;
+    prepare_constants(result);
+    compress_blocks(result, &input[0], 1);
+    return to_hash(result);
+}
+
+template <typename ByteContainer> hash sha256(const ByteContainer& input)
+{
+    std::vector<uint8_t> message_schedule;
+    message_schedule.reserve(input.size() + 72);
+
+    std::copy(input.begin(), input.end(), std::back_inserter(message_schedule));
+    append_padding(message_schedule);
+
+    std::array<uint32_t, 8> rolling_hash;
+    prepare_constants(rolling_hash);
+    compress_blocks(rolling_hash, &message_schedule[0], message_schedule.size() / 64);
+    return to_hash(rolling_hash);
+}
+
+std::vector<hash> sha256_batch(std::span<const std::vector<uint8_t>> inputs)
+{
+    std::vector<hash> outputs(inputs.size());
+    size_t i = 0;
+#if BBERG_SHA256_SIMD
+    size_t lanes = 0;
+    lanes_kernel kernel = nullptr;
+    // Sixteen lanes of AVX-512 beat the SHA extensions, which beat eight lanes of AVX2
+    if (has_avx512()) {
+        lanes = 16;
+        kernel = sha256_block_x16;
+    } else if (has_avx2() && !has_sha_ni()) {
+        lanes = 8;
+        kernel = sha256_block_x8;
+    }
+    if (kernel != nullptr) {
+        std::vector<std::vector<uint8_t>> padded(lanes);
+        // A group that would leave more than half the lanes idle is left to sha256()
+        for (; i < inputs.size() && (inputs.size() - i) * 2 >= lanes; i += lanes) {
+            const size_t num_messages = std::min(lanes, inputs.size() - i);
+            for (size_t lane = 0; lane < num_messages; ++lane) {
+                padded[lane].assign(inputs[i + lane].begin(), inputs[i + lane].end());
+                append_padding(padded[lane]);
+            }
+            sha256_lanes(std::span(padded).first(num_messages), &outputs[i], lanes, kernel);
+        }
+    }
+#endif
+    for (; i < inputs.size(); ++i) {
+        outputs[i] = sha256(inputs[i]);
+    }
+    return outputs;
 }
 
 template hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& input);
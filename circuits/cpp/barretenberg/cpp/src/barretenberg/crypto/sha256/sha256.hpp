@@ -5,6 +5,7 @@
 #include <array>
 #include <iomanip>
 #include <ostream>
+#include <span>
 #include <vector>
 
 namespace sha256 {
@@ -19,6 +20,16 @@ extern template hash sha256<std::vector<uint8_t>>(const std::vector<uint8_t>& in
 extern template hash sha256<std::array<uint8_t, 32>>(const std::array<uint8_t, 32>& input);
 extern template hash sha256<std::string>(const std::string& input);
 
+/**
+ * @brief Hashes each of inputs, returning the hashes in the same order.
+ *
+ * @details Independent messages are hashed side by side, one per SIMD lane: sixteen at a time with AVX-512, or eight
+ * at a time with AVX2 if the CPU lacks the SHA extensions (which beat eight lanes). Messages of different lengths can
+ * share a batch, though a lane whose message is done idles until the longest in its group is. Messages left over go
+ * through sha256(), as does every message on other CPUs; sha256() uses the SHA extensions where the CPU has them.
+ */
+std::vector<hash> sha256_batch(std::span<const std::vector<uint8_t>> inputs);
+
 inline barretenberg::fr sha256_to_field(std::vector<uint8_t> const& input)
 {
     auto result = sha256::sha256(input);
@@ -98,3 +98,39 @@ TEST(misc_sha256, test_NIST_vector_five)
         EXPECT_EQ(result[i], expected[i]);
     }
 }
+
+TEST(misc_sha256, batch_matches_sha256)
+{
+    // Lengths either side of the one and two block padding boundaries, and enough messages to leave a partial group
+    std::vector<std::vector<uint8_t>> inputs;
+    for (size_t i = 0; i < 152; ++i) {
+        std::vector<uint8_t> input(i % 3 == 0 ? 200 - i : i);
+        for (size_t j = 0; j < input.size(); ++j) {
+            input[j] = static_cast<uint8_t>(i * 31 + j * 7);
+        }
+        inputs.push_back(input);
+    }
+
+    auto results = sha256::sha256_batch(inputs);
+
+    EXPECT_EQ(results.size(), inputs.size());
+    for (size_t i = 0; i < inputs.size(); ++i) {
+        EXPECT_EQ(results[i], sha256::sha256(inputs[i]));
+    }
+}
+
+TEST(misc_sha256, batch_of_NIST_vectors)
+{
+    std::string input_str = "abc";
+    std::vector<std::vector<uint8_t>> inputs(20, std::vector<uint8_t>(input_str.begin(), input_str.end()));
+
+    auto results = sha256::sha256_batch(inputs);
+
+    sha256::hash expected{
+        0xBA, 0x78, 0x16, 0xBF, 0x8F, 0x01, 0xCF, 0xEA, 0x41, 0x41, 0x40, 0xDE, 0x5D, 0xAE, 0x22, 0x23,
+        0xB0, 0x03, 0x61, 0xA3, 0x96, 0x17, 0x7A, 0x9C, 0xB4, 0x10, 0xFF, 0x61, 0xF2, 0x00, 0x15, 0xAD,
+    };
+    for (const auto& result : results) {
+        EXPECT_EQ(result, expected);
+    }
+}
@@ -62,6 +62,8 @@ std::vector<uint8_t> AcirComposer::create_proof(
     composer_ = acir_format::Composer(/*p_key=*/0, /*v_key=*/0);
 
     vinfo("building circuit...");
+    // Start from an empty builder, as init_proving_key may have built the circuit (without witnesses) already.
+    builder_ = acir_format::Builder();
     create_circuit_with_witness(builder_, constraint_system, witness);
     vinfo("gates: ", builder_.get_total_circuit_size());
 
@@ -69,7 +71,7 @@ std::vector<uint8_t> AcirComposer::create_proof(
         if (proving_key_) {
             auto composer = acir_format::Composer(proving_key_, verification_key_);
             // You can't produce the verification key unless you manually set the crs. Which seems like a bug.
-            composer_.crs_factory_ = crs_factory;
+            composer.crs_factory_ = crs_factory;
             return composer;
         } else {
             return acir_format::Composer(crs_factory);
@@ -89,11 +91,14 @@ std::vector<uint8_t> AcirComposer::create_proof(
 
     vinfo("creating proof...");
     std::vector<uint8_t> proof;
+    // The witness is computed afresh for every proof, so the prover can free it as it goes.
     if (is_recursive) {
         auto prover = composer_.create_prover(builder_);
+        prover.release_witness_polynomials = true;
         proof = prover.construct_proof().proof_data;
     } else {
         auto prover = composer_.create_ultra_with_keccak_prover(builder_);
+        prover.release_witness_polynomials = true;
         proof = prover.construct_proof().proof_data;
     }
     vinfo("done.");
@@ -108,6 +113,16 @@ std::shared_ptr<proof_system::plonk::verification_key> AcirComposer::init_verifi
     return verification_key_;
 }
 
+void AcirComposer::load_proving_key(
+    std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> const& crs_factory,
+    proof_system::plonk::proving_key_data&& data)
+{
+    auto crs = crs_factory->get_prover_crs(data.circuit_size + 1);
+    proving_key_ = std::make_shared<proof_system::plonk::proving_key>(std::move(data), crs);
+    composer_ = acir_format::Composer(proving_key_, verification_key_);
+    composer_.crs_factory_ = crs_factory;
+}
+
 void AcirComposer::load_verification_key(
     std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> const& crs_factory,
     proof_system::plonk::verification_key_data&& data)
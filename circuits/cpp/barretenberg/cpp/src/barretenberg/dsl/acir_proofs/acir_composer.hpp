@@ -23,6 +23,15 @@ class AcirComposer {
         acir_format::WitnessVector& witness,
         bool is_recursive);
 
+    /**
+     * @brief Uses a previously computed (e.g. cached) proving key for this circuit, rather than computing it from the
+     * constraint system in create_proof.
+     */
+    void load_proving_key(std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> const& crs_factory,
+                          proof_system::plonk::proving_key_data&& data);
+
+    std::shared_ptr<proof_system::plonk::proving_key> get_proving_key() { return proving_key_; }
+
     void load_verification_key(
         std::shared_ptr<barretenberg::srs::factories::CrsFactory<curve::BN254>> const& crs_factory,
         proof_system::plonk::verification_key_data&& data);
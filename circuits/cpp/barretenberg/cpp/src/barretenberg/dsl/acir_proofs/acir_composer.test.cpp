@@ -0,0 +1,88 @@
+#include "acir_composer.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+#include <gtest/gtest.h>
+
+namespace acir_proofs::tests {
+
+namespace {
+// a + b = c
+acir_format::acir_format get_constraint_system()
+{
+    poly_triple constraint{
+        .a = 1,
+        .b = 2,
+        .c = 3,
+        .q_m = 0,
+        .q_l = 1,
+        .q_r = 1,
+        .q_o = -1,
+        .q_c = 0,
+    };
+
+    return acir_format::acir_format{
+        .varnum = 4,
+        .public_inputs = { 1 },
+        .logic_constraints = {},
+        .range_constraints = {},
+        .sha256_constraints = {},
+        .schnorr_constraints = {},
+        .ecdsa_k1_constraints = {},
+        .ecdsa_r1_constraints = {},
+        .blake2s_constraints = {},
+        .keccak_constraints = {},
+        .keccak_var_constraints = {},
+        .pedersen_constraints = {},
+        .hash_to_field_constraints = {},
+        .fixed_base_scalar_mul_constraints = {},
+        .recursion_constraints = {},
+        .constraints = { constraint },
+        .block_constraints = {},
+    };
+}
+} // namespace
+
+// A proving key that went through serialization (as the bb cli's proving key cache does) proves just like a freshly
+// computed one, and gives the same verification key.
+TEST(AcirComposer, ProveWithLoadedProvingKey)
+{
+    auto crs_factory =
+        std::make_shared<barretenberg::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+
+    AcirComposer key_composer(0, false);
+    auto constraint_system = get_constraint_system();
+    key_composer.init_proving_key(crs_factory, constraint_system);
+    auto key_buffer = to_buffer(*key_composer.get_proving_key());
+    auto expected_vk = to_buffer(*key_composer.init_verification_key());
+
+    AcirComposer composer(0, false);
+    composer.load_proving_key(crs_factory, from_buffer<proof_system::plonk::proving_key_data>(key_buffer));
+    EXPECT_EQ(to_buffer(*composer.init_verification_key()), expected_vk);
+
+    for (bool is_recursive : { false, true }) {
+        AcirComposer prover(0, false);
+        prover.load_proving_key(crs_factory, from_buffer<proof_system::plonk::proving_key_data>(key_buffer));
+        constraint_system = get_constraint_system();
+        acir_format::WitnessVector witness = { 1, 2, 3 };
+        auto proof = prover.create_proof(crs_factory, constraint_system, witness, is_recursive);
+        EXPECT_TRUE(prover.verify_proof(proof, is_recursive));
+    }
+}
+
+// Proving after init_proving_key rebuilds the circuit rather than adding to the one the key was computed from.
+TEST(AcirComposer, ProveAfterInitProvingKey)
+{
+    auto crs_factory =
+        std::make_shared<barretenberg::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+
+    AcirComposer composer(0, false);
+    auto constraint_system = get_constraint_system();
+    composer.init_proving_key(crs_factory, constraint_system);
+    constraint_system = get_constraint_system();
+    acir_format::WitnessVector witness = { 1, 2, 3 };
+    auto proof = composer.create_proof(crs_factory, constraint_system, witness, false);
+    EXPECT_TRUE(composer.verify_proof(proof, false));
+}
+
+} // namespace acir_proofs::tests
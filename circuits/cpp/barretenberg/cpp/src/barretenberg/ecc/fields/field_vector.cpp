@@ -0,0 +1,17 @@
+#include "field_vector.hpp"
+#include <cstdlib>
+
+namespace barretenberg::field_vector_detail {
+
+bool has_avx512_ifma()
+{
+#if BBERG_FIELD_VECTOR_SIMD
+    static const bool supported = std::getenv("BB_NO_SIMD") == nullptr && __builtin_cpu_supports("avx512f") &&
+                                  __builtin_cpu_supports("avx512ifma");
+    return supported;
+#else
+    return false;
+#endif
+}
+
+} // namespace barretenberg::field_vector_detail
@@ -0,0 +1,441 @@
+#pragma once
+#include "field.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+#if (BBERG_NO_ASM == 0)
+#include <immintrin.h>
+#define BBERG_FIELD_VECTOR_SIMD 1
+#else
+#define BBERG_FIELD_VECTOR_SIMD 0
+#endif
+
+namespace barretenberg {
+
+namespace field_vector_detail {
+/**
+ * @brief Whether the CPU we are running on has the AVX-512 IFMA (52-bit integer fused multiply-add) instructions the
+ * vector kernels use. Checked once. Setting the environment variable BB_NO_SIMD forces the scalar code paths.
+ */
+bool has_avx512_ifma();
+
+enum class op { mul, add, sub };
+} // namespace field_vector_detail
+
+/**
+ * @brief A vector of field elements stored limb-major (structure of arrays): limb 0 of every element, then limb 1 of
+ * every element, and so on. Elements are in the same (Montgomery, coarsely reduced) form as `field<Params>`.
+ *
+ * Element-wise arithmetic is dispatched at runtime. On CPUs with AVX-512 IFMA, eight elements are processed at once:
+ * each is split into five 52-bit limbs, one per 64-bit lane, and multiplied with `vpmadd52{lo,hi}uq` using Montgomery
+ * reduction with R = 2^260 (one input is pre-scaled by 2^4 to keep results in the usual R = 2^256 form). Otherwise,
+ * and for fields of 255 bits or more, the scalar `field` arithmetic is used.
+ *
+ * The static `mul`/`sqr`/`add`/`sub` overloads taking raw pointers apply the same kernels to ordinary arrays of
+ * `field<Params>`, transposing eight elements at a time in registers, so existing array-of-structs code can use them
+ * without changing its layout.
+ *
+ * There is no AVX2 kernel: without a 52-bit multiplier, a 4-lane Montgomery multiplication built from 32-bit
+ * multiplies does not beat the scalar MULX/ADX code.
+ */
+template <class Params> class field_vector {
+  public:
+    using Fr = field<Params>;
+    static constexpr size_t LANES = 8;
+
+    field_vector() = default;
+    explicit field_vector(size_t size)
+        : size_(size)
+        , padded_size_((size + LANES - 1) & ~(LANES - 1))
+        , limbs_(4 * padded_size_, 0)
+    {}
+    explicit field_vector(std::span<const Fr> elements)
+        : field_vector(elements.size())
+    {
+        for (size_t i = 0; i < size_; ++i) {
+            set(i, elements[i]);
+        }
+    }
+
+    size_t size() const { return size_; }
+
+    Fr operator[](size_t i) const
+    {
+        return Fr(limb(0)[i], limb(1)[i], limb(2)[i], limb(3)[i]);
+    }
+
+    void set(size_t i, const Fr& value)
+    {
+        for (size_t j = 0; j < 4; ++j) {
+            limb(j)[i] = value.data[j];
+        }
+    }
+
+    void store(std::span<Fr> elements) const
+    {
+        ASSERT(elements.size() >= size_);
+        for (size_t i = 0; i < size_; ++i) {
+            elements[i] = (*this)[i];
+        }
+    }
+
+    uint64_t* limb(size_t j) { return &limbs_[j * padded_size_]; }
+    const uint64_t* limb(size_t j) const { return &limbs_[j * padded_size_]; }
+
+    // Element-wise r = a * b, r = a * a, r = a + b, r = a - b. All vectors must have the same size; r may alias a or b.
+    static void mul(field_vector& r, const field_vector& a, const field_vector& b)
+    {
+        apply<field_vector_detail::op::mul>(r, a, b);
+    }
+    static void sqr(field_vector& r, const field_vector& a) { apply<field_vector_detail::op::mul>(r, a, a); }
+    static void add(field_vector& r, const field_vector& a, const field_vector& b)
+    {
+        apply<field_vector_detail::op::add>(r, a, b);
+    }
+    static void sub(field_vector& r, const field_vector& a, const field_vector& b)
+    {
+        apply<field_vector_detail::op::sub>(r, a, b);
+    }
+
+    // The same, on plain arrays of `n` elements. r may alias a or b.
+    static void mul(Fr* r, const Fr* a, const Fr* b, size_t n) { apply<field_vector_detail::op::mul>(r, a, b, n); }
+    static void sqr(Fr* r, const Fr* a, size_t n) { apply<field_vector_detail::op::mul>(r, a, a, n); }
+    static void add(Fr* r, const Fr* a, const Fr* b, size_t n) { apply<field_vector_detail::op::add>(r, a, b, n); }
+    static void sub(Fr* r, const Fr* a, const Fr* b, size_t n) { apply<field_vector_detail::op::sub>(r, a, b, n); }
+
+    // Whether the vector kernels are used for this field on this machine.
+    static bool use_simd()
+    {
+        if constexpr (BBERG_FIELD_VECTOR_SIMD && Params::modulus_3 < 0x4000000000000000ULL) {
+            return field_vector_detail::has_avx512_ifma();
+        } else {
+            return false;
+        }
+    }
+
+  private:
+    template <field_vector_detail::op operation> static void apply(Fr* r, const Fr* a, const Fr* b, size_t n);
+    template <field_vector_detail::op operation>
+    static void apply(field_vector& r, const field_vector& a, const field_vector& b);
+
+    size_t size_ = 0;
+    size_t padded_size_ = 0;
+    std::vector<uint64_t> limbs_;
+};
+
+#if BBERG_FIELD_VECTOR_SIMD
+// GCC's AVX-512 shift intrinsics start from _mm512_undefined_epi32(), which trips its own uninitialized warning.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+namespace field_vector_detail {
+
+#define BBERG_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+
+// Eight field elements, one per lane, as five 52-bit limbs (the top limb may be wider between operations).
+struct ifma_elements {
+    __m512i limb[5];
+};
+
+// Eight field elements, one per lane, as four 64-bit limbs.
+struct u64_elements {
+    __m512i limb[4];
+};
+
+BBERG_IFMA_TARGET inline __m512i mask52()
+{
+    return _mm512_set1_epi64(0xfffffffffffffULL);
+}
+
+// Splits 4 x 64-bit limbs into 5 x 52-bit limbs, multiplying by 2^shift (shift <= 4, and the result must fit 260 bits).
+template <int shift> BBERG_IFMA_TARGET inline ifma_elements to_radix_52(const u64_elements& x)
+{
+    const __m512i m = mask52();
+    ifma_elements r;
+    r.limb[0] = _mm512_and_si512(_mm512_slli_epi64(x.limb[0], shift), m);
+    r.limb[1] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(x.limb[0], 52 - shift), _mm512_slli_epi64(x.limb[1], 12 + shift)), m);
+    r.limb[2] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(x.limb[1], 40 - shift), _mm512_slli_epi64(x.limb[2], 24 + shift)), m);
+    r.limb[3] = _mm512_and_si512(
+        _mm512_or_si512(_mm512_srli_epi64(x.limb[2], 28 - shift), _mm512_slli_epi64(x.limb[3], 36 + shift)), m);
+    r.limb[4] = _mm512_srli_epi64(x.limb[3], 16 - shift);
+    return r;
+}
+
+// Joins 5 normalised 52-bit limbs (holding a value below 2^256) back into 4 x 64-bit limbs.
+BBERG_IFMA_TARGET inline u64_elements from_radix_52(const ifma_elements& x)
+{
+    u64_elements r;
+    r.limb[0] = _mm512_or_si512(x.limb[0], _mm512_slli_epi64(x.limb[1], 52));
+    r.limb[1] = _mm512_or_si512(_mm512_srli_epi64(x.limb[1], 12), _mm512_slli_epi64(x.limb[2], 40));
+    r.limb[2] = _mm512_or_si512(_mm512_srli_epi64(x.limb[2], 24), _mm512_slli_epi64(x.limb[3], 28));
+    r.limb[3] = _mm512_or_si512(_mm512_srli_epi64(x.limb[3], 36), _mm512_slli_epi64(x.limb[4], 16));
+    return r;
+}
+
+// Propagates carries so every limb but the top one holds 52 bits. Limbs are treated as signed, so this also
+// propagates borrows; the sign of the result ends up in the top limb.
+BBERG_IFMA_TARGET inline void normalise(ifma_elements& x)
+{
+    const __m512i m = mask52();
+    for (size_t i = 0; i < 4; ++i) {
+        x.limb[i + 1] = _mm512_add_epi64(x.limb[i + 1], _mm512_srai_epi64(x.limb[i], 52));
+        x.limb[i] = _mm512_and_si512(x.limb[i], m);
+    }
+}
+
+template <class Params> BBERG_IFMA_TARGET inline ifma_elements twice_modulus_52()
+{
+    constexpr uint256_t p2 = field<Params>::modulus + field<Params>::modulus;
+    ifma_elements r;
+    r.limb[0] = _mm512_set1_epi64((long long)(p2.data[0] & 0xfffffffffffffULL));
+    r.limb[1] = _mm512_set1_epi64((long long)(((p2.data[0] >> 52) | (p2.data[1] << 12)) & 0xfffffffffffffULL));
+    r.limb[2] = _mm512_set1_epi64((long long)(((p2.data[1] >> 40) | (p2.data[2] << 24)) & 0xfffffffffffffULL));
+    r.limb[3] = _mm512_set1_epi64((long long)(((p2.data[2] >> 28) | (p2.data[3] << 36)) & 0xfffffffffffffULL));
+    r.limb[4] = _mm512_set1_epi64((long long)(p2.data[3] >> 16));
+    return r;
+}
+
+/**
+ * @brief Montgomery multiplication of eight pairs of elements in [0, 2p).
+ *
+ * The product of a and 2^4 * b is reduced five times by 52 bits, giving a * b * 2^4 / 2^260 = a * b / 2^256, i.e. the
+ * usual Montgomery product. As a < 2p and 2^4 * b < 2^5 p with 4p < 2^256, the result is below 2p, matching the coarse
+ * reduction of the scalar code.
+ */
+template <class Params> BBERG_IFMA_TARGET inline u64_elements montgomery_mul(const u64_elements& a_in,
+                                                                              const u64_elements& b_in)
+{
+    const ifma_elements a = to_radix_52<0>(a_in);
+    const ifma_elements b = to_radix_52<4>(b_in);
+    constexpr uint256_t p = field<Params>::modulus;
+    const __m512i m = mask52();
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i p_limbs[5] = {
+        _mm512_set1_epi64((long long)(p.data[0] & 0xfffffffffffffULL)),
+        _mm512_set1_epi64((long long)(((p.data[0] >> 52) | (p.data[1] << 12)) & 0xfffffffffffffULL)),
+        _mm512_set1_epi64((long long)(((p.data[1] >> 40) | (p.data[2] << 24)) & 0xfffffffffffffULL)),
+        _mm512_set1_epi64((long long)(((p.data[2] >> 28) | (p.data[3] << 36)) & 0xfffffffffffffULL)),
+        _mm512_set1_epi64((long long)(p.data[3] >> 16)),
+    };
+    const __m512i r_inv = _mm512_set1_epi64((long long)(Params::r_inv & 0xfffffffffffffULL));
+
+    // Operand scanning, interleaving each row of the product with one step of the reduction. Columns accumulate at
+    // most 22 terms of 52 bits, so never overflow.
+    __m512i t[10];
+    for (auto& column : t) {
+        column = zero;
+    }
+    for (size_t i = 0; i < 5; ++i) {
+        for (size_t j = 0; j < 5; ++j) {
+            t[i + j] = _mm512_madd52lo_epu64(t[i + j], a.limb[i], b.limb[j]);
+            t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], a.limb[i], b.limb[j]);
+        }
+        const __m512i q = _mm512_madd52lo_epu64(zero, t[i], r_inv);
+        for (size_t j = 0; j < 5; ++j) {
+            t[i + j] = _mm512_madd52lo_epu64(t[i + j], q, p_limbs[j]);
+            t[i + j + 1] = _mm512_madd52hi_epu64(t[i + j + 1], q, p_limbs[j]);
+        }
+        // The low 52 bits of t[i] are now zero.
+        t[i + 1] = _mm512_add_epi64(t[i + 1], _mm512_srli_epi64(t[i], 52));
+    }
+
+    ifma_elements r;
+    for (size_t i = 0; i < 5; ++i) {
+        r.limb[i] = t[i + 5];
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        r.limb[i + 1] = _mm512_add_epi64(r.limb[i + 1], _mm512_srli_epi64(r.limb[i], 52));
+        r.limb[i] = _mm512_and_si512(r.limb[i], m);
+    }
+    return from_radix_52(r);
+}
+
+// a + b for a, b in [0, 2p), reduced back into [0, 2p).
+template <class Params> BBERG_IFMA_TARGET inline u64_elements add(const u64_elements& a_in, const u64_elements& b_in)
+{
+    ifma_elements a = to_radix_52<0>(a_in);
+    const ifma_elements b = to_radix_52<0>(b_in);
+    const ifma_elements p2 = twice_modulus_52<Params>();
+    ifma_elements reduced;
+    for (size_t i = 0; i < 5; ++i) {
+        a.limb[i] = _mm512_add_epi64(a.limb[i], b.limb[i]);
+        reduced.limb[i] = _mm512_sub_epi64(a.limb[i], p2.limb[i]);
+    }
+    normalise(a);
+    normalise(reduced);
+    // Keep the sum minus 2p unless that went negative.
+    const __mmask8 negative = _mm512_cmplt_epi64_mask(reduced.limb[4], _mm512_setzero_si512());
+    for (size_t i = 0; i < 5; ++i) {
+        reduced.limb[i] = _mm512_mask_blend_epi64(negative, reduced.limb[i], a.limb[i]);
+    }
+    return from_radix_52(reduced);
+}
+
+// a - b for a, b in [0, 2p), reduced back into [0, 2p).
+template <class Params> BBERG_IFMA_TARGET inline u64_elements sub(const u64_elements& a_in, const u64_elements& b_in)
+{
+    ifma_elements a = to_radix_52<0>(a_in);
+    const ifma_elements b = to_radix_52<0>(b_in);
+    const ifma_elements p2 = twice_modulus_52<Params>();
+    ifma_elements wrapped;
+    for (size_t i = 0; i < 5; ++i) {
+        a.limb[i] = _mm512_sub_epi64(a.limb[i], b.limb[i]);
+        wrapped.limb[i] = _mm512_add_epi64(a.limb[i], p2.limb[i]);
+    }
+    normalise(a);
+    normalise(wrapped);
+    // Add 2p back if the difference went negative.
+    const __mmask8 negative = _mm512_cmplt_epi64_mask(a.limb[4], _mm512_setzero_si512());
+    for (size_t i = 0; i < 5; ++i) {
+        a.limb[i] = _mm512_mask_blend_epi64(negative, a.limb[i], wrapped.limb[i]);
+    }
+    return from_radix_52(a);
+}
+
+// Loads eight consecutive limb-major elements.
+BBERG_IFMA_TARGET inline u64_elements load_soa(const uint64_t* const limbs[4], size_t i)
+{
+    u64_elements r;
+    for (size_t j = 0; j < 4; ++j) {
+        r.limb[j] = _mm512_loadu_si512(limbs[j] + i);
+    }
+    return r;
+}
+
+BBERG_IFMA_TARGET inline void store_soa(uint64_t* const limbs[4], size_t i, const u64_elements& x)
+{
+    for (size_t j = 0; j < 4; ++j) {
+        _mm512_storeu_si512(limbs[j] + i, x.limb[j]);
+    }
+}
+
+/**
+ * Loads eight consecutive array-of-structs elements (32 64-bit words), and transposes them so each register holds one
+ * limb of every element. Each register loaded holds two elements; two rounds of two-source permutes transpose them.
+ */
+BBERG_IFMA_TARGET inline u64_elements load_aos(const uint64_t* words)
+{
+    const __m512i x0 = _mm512_loadu_si512(words);
+    const __m512i x1 = _mm512_loadu_si512(words + 8);
+    const __m512i x2 = _mm512_loadu_si512(words + 16);
+    const __m512i x3 = _mm512_loadu_si512(words + 24);
+    // Limbs 0 and 1, then limbs 2 and 3, of four elements.
+    const __m512i lo = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+    const __m512i hi = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+    const __m512i t0 = _mm512_permutex2var_epi64(x0, lo, x1);
+    const __m512i t1 = _mm512_permutex2var_epi64(x0, hi, x1);
+    const __m512i t2 = _mm512_permutex2var_epi64(x2, lo, x3);
+    const __m512i t3 = _mm512_permutex2var_epi64(x2, hi, x3);
+    const __m512i first = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+    const __m512i second = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+    u64_elements r;
+    r.limb[0] = _mm512_permutex2var_epi64(t0, first, t2);
+    r.limb[1] = _mm512_permutex2var_epi64(t0, second, t2);
+    r.limb[2] = _mm512_permutex2var_epi64(t1, first, t3);
+    r.limb[3] = _mm512_permutex2var_epi64(t1, second, t3);
+    return r;
+}
+
+// The inverse of load_aos.
+BBERG_IFMA_TARGET inline void store_aos(uint64_t* words, const u64_elements& x)
+{
+    // Limbs 0 to 3 of elements 0, 1, 4, 5, then of elements 2, 3, 6, 7.
+    const __m512i lo = _mm512_set_epi64(13, 5, 12, 4, 9, 1, 8, 0);
+    const __m512i hi = _mm512_set_epi64(15, 7, 14, 6, 11, 3, 10, 2);
+    const __m512i t0 = _mm512_permutex2var_epi64(x.limb[0], lo, x.limb[1]);
+    const __m512i t1 = _mm512_permutex2var_epi64(x.limb[0], hi, x.limb[1]);
+    const __m512i t2 = _mm512_permutex2var_epi64(x.limb[2], lo, x.limb[3]);
+    const __m512i t3 = _mm512_permutex2var_epi64(x.limb[2], hi, x.limb[3]);
+    // Interleave the (limb 0, limb 1) pairs of t0/t1 with the (limb 2, limb 3) pairs of t2/t3.
+    const __m512i first = _mm512_set_epi64(11, 10, 3, 2, 9, 8, 1, 0);
+    const __m512i second = _mm512_set_epi64(15, 14, 7, 6, 13, 12, 5, 4);
+    _mm512_storeu_si512(words, _mm512_permutex2var_epi64(t0, first, t2));
+    _mm512_storeu_si512(words + 8, _mm512_permutex2var_epi64(t1, first, t3));
+    _mm512_storeu_si512(words + 16, _mm512_permutex2var_epi64(t0, second, t2));
+    _mm512_storeu_si512(words + 24, _mm512_permutex2var_epi64(t1, second, t3));
+}
+
+template <class Params, op operation>
+BBERG_IFMA_TARGET inline u64_elements apply(const u64_elements& a, const u64_elements& b)
+{
+    if constexpr (operation == op::mul) {
+        return montgomery_mul<Params>(a, b);
+    } else if constexpr (operation == op::add) {
+        return add<Params>(a, b);
+    } else {
+        return sub<Params>(a, b);
+    }
+}
+
+template <class Params, op operation>
+BBERG_IFMA_TARGET void apply_soa(
+    uint64_t* const r[4], const uint64_t* const a[4], const uint64_t* const b[4], size_t padded_size)
+{
+    for (size_t i = 0; i < padded_size; i += 8) {
+        store_soa(r, i, apply<Params, operation>(load_soa(a, i), load_soa(b, i)));
+    }
+}
+
+template <class Params, op operation>
+BBERG_IFMA_TARGET void apply_aos(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t num_blocks)
+{
+    for (size_t i = 0; i < num_blocks * 32; i += 32) {
+        store_aos(r + i, apply<Params, operation>(load_aos(a + i), load_aos(b + i)));
+    }
+}
+
+#undef BBERG_IFMA_TARGET
+
+} // namespace field_vector_detail
+#pragma GCC diagnostic pop
+#endif
+
+template <class Params>
+template <field_vector_detail::op operation>
+void field_vector<Params>::apply(Fr* r, const Fr* a, const Fr* b, size_t n)
+{
+    size_t done = 0;
+#if BBERG_FIELD_VECTOR_SIMD
+    if (use_simd() && n >= LANES) {
+        done = n & ~(LANES - 1);
+        field_vector_detail::apply_aos<Params, operation>(&r[0].data[0], &a[0].data[0], &b[0].data[0], done / LANES);
+    }
+#endif
+    for (size_t i = done; i < n; ++i) {
+        if constexpr (operation == field_vector_detail::op::mul) {
+            r[i] = a[i] * b[i];
+        } else if constexpr (operation == field_vector_detail::op::add) {
+            r[i] = a[i] + b[i];
+        } else {
+            r[i] = a[i] - b[i];
+        }
+    }
+}
+
+template <class Params>
+template <field_vector_detail::op operation>
+void field_vector<Params>::apply(field_vector& r, const field_vector& a, const field_vector& b)
+{
+    ASSERT(r.size_ == a.size_ && a.size_ == b.size_);
+#if BBERG_FIELD_VECTOR_SIMD
+    if (use_simd()) {
+        uint64_t* const r_limbs[4] = { r.limb(0), r.limb(1), r.limb(2), r.limb(3) };
+        const uint64_t* const a_limbs[4] = { a.limb(0), a.limb(1), a.limb(2), a.limb(3) };
+        const uint64_t* const b_limbs[4] = { b.limb(0), b.limb(1), b.limb(2), b.limb(3) };
+        field_vector_detail::apply_soa<Params, operation>(r_limbs, a_limbs, b_limbs, r.padded_size_);
+        return;
+    }
+#endif
+    for (size_t i = 0; i < r.size_; ++i) {
+        const Fr x = a[i];
+        const Fr y = b[i];
+        Fr result;
+        apply<operation>(&result, &x, &y, 1);
+        r.set(i, result);
+    }
+}
+
+} // namespace barretenberg
@@ -0,0 +1,91 @@
+#include "field_vector.hpp"
+#include "../curves/bn254/fq.hpp"
+#include "../curves/bn254/fr.hpp"
+#include "../curves/secp256k1/secp256k1.hpp"
+#include <gtest/gtest.h>
+
+using namespace barretenberg;
+
+namespace {
+
+// Random elements, some in the unreduced [p, 2p) range that coarse reduction produces, plus the extremes.
+template <typename Fr> std::vector<Fr> random_elements(size_t n)
+{
+    std::vector<Fr> elements(n);
+    for (size_t i = 0; i < n; ++i) {
+        elements[i] = Fr::random_element();
+        if constexpr (Fr::Params::modulus_3 < 0x4000000000000000ULL) {
+            if (i % 3 == 0) {
+                elements[i] = Fr(uint256_t(elements[i]) + Fr::modulus);
+            }
+        }
+    }
+    elements[0] = Fr::zero();
+    elements[1] = Fr::neg_one();
+    if constexpr (Fr::Params::modulus_3 < 0x4000000000000000ULL) {
+        elements[2] = Fr(Fr::modulus + Fr::modulus - 1);
+        elements[3] = Fr(Fr::modulus);
+    }
+    return elements;
+}
+
+template <typename Fr> void check_against_scalar()
+{
+    using vector = field_vector<typename Fr::Params>;
+    // Not a multiple of the vector width, so the scalar tails are exercised too.
+    constexpr size_t n = 203;
+    auto a = random_elements<Fr>(n);
+    auto b = random_elements<Fr>(n);
+    std::reverse(b.begin(), b.end());
+
+    std::vector<Fr> r(n);
+    vector::mul(r.data(), a.data(), b.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(r[i], a[i] * b[i]);
+        // Results stay coarsely reduced, so they are valid inputs to further (vector or scalar) arithmetic.
+        EXPECT_LT(uint256_t(r[i].data[0], r[i].data[1], r[i].data[2], r[i].data[3]), Fr::modulus + Fr::modulus);
+    }
+    vector::sqr(r.data(), a.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(r[i], a[i].sqr());
+    }
+    vector::add(r.data(), a.data(), b.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(r[i], a[i] + b[i]);
+    }
+    vector::sub(r.data(), a.data(), b.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(r[i], a[i] - b[i]);
+    }
+
+    vector va(a);
+    vector vb(b);
+    vector vr(n);
+    vector::mul(vr, va, vb);
+    vector::sub(vr, vr, va);
+    vector::add(vr, vr, vb);
+    vector::sqr(vr, vr);
+    for (size_t i = 0; i < n; ++i) {
+        EXPECT_EQ(vr[i], (a[i] * b[i] - a[i] + b[i]).sqr());
+    }
+    vr.store(r);
+    EXPECT_EQ(r[n - 1], vr[n - 1]);
+}
+
+} // namespace
+
+TEST(field_vector, Bn254Fr)
+{
+    check_against_scalar<fr>();
+}
+
+TEST(field_vector, Bn254Fq)
+{
+    check_against_scalar<fq>();
+}
+
+TEST(field_vector, Secp256k1FqFallsBackToScalar)
+{
+    EXPECT_FALSE(field_vector<secp256k1::fq::Params>::use_simd());
+    check_against_scalar<secp256k1::fq>();
+}
@@ -8,6 +8,7 @@
 #include "wnaf.hpp"
 #include <array>
 #include <random>
+#include <span>
 #include <vector>
 
 namespace barretenberg::group_elements {
@@ -92,7 +93,7 @@ template <class Fq, class Fr, class Params> class alignas(32) element {
 
     static void batch_normalize(element* elements, size_t num_elements) noexcept;
     static std::vector<affine_element<Fq, Fr, Params>> batch_mul_with_endomorphism(
-        const std::vector<affine_element<Fq, Fr, Params>>& points, const Fr& exponent) noexcept;
+        std::span<const affine_element<Fq, Fr, Params>> points, const Fr& exponent) noexcept;
 
     Fq x;
     Fq y;
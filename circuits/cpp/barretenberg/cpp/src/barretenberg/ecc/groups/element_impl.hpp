@@ -688,7 +688,7 @@ element<Fq, Fr, T> element<Fq, Fr, T>::mul_with_endomorphism(const Fr& exponent)
 
 template <class Fq, class Fr, class T>
 std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomorphism(
-    const std::vector<affine_element<Fq, Fr, T>>& points, const Fr& exponent) noexcept
+    std::span<const affine_element<Fq, Fr, T>> points, const Fr& exponent) noexcept
 {
     typedef affine_element<Fq, Fr, T> affine_element;
     const size_t num_points = points.size();
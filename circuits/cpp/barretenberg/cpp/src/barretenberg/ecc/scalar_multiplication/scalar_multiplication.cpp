@@ -1,14 +1,20 @@
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
 #include <memory>
+#include <span>
+#include <vector>
 
+#include "./point_table.hpp"
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
 #include "./scalar_multiplication.hpp"
 
+#include "barretenberg/common/assert.hpp"
 #include "barretenberg/common/mem.hpp"
+#include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
@@ -114,6 +120,53 @@ void generate_pippenger_point_table(typename Curve::AffineElement* points,
     }
 }
 
+/**
+ * Computes the wnaf entries and skews for the tranche of scalars assigned to `thread_index`.
+ * `thread_round_counts` is the thread-local array of per-round point counts, it is incremented (not overwritten).
+ * Shared by `compute_wnaf_states` and `pippenger_batch`, see `compute_wnaf_states` for a description of the algorithm.
+ **/
+template <typename Curve>
+void compute_thread_wnaf_states(uint64_t* point_schedule,
+                                bool* input_skew_table,
+                                uint64_t* thread_round_counts,
+                                const typename Curve::ScalarField* scalars,
+                                const size_t num_initial_points,
+                                const size_t thread_index,
+                                const size_t wnaf_bits)
+{
+    using Fr = typename Curve::ScalarField;
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_threads = get_num_cpus_pow2();
+    const size_t num_initial_points_per_thread = num_initial_points / num_threads;
+    const size_t num_points_per_thread = num_points / num_threads;
+
+    Fr T0;
+    uint64_t* wnaf_table = &point_schedule[(2 * thread_index) * num_initial_points_per_thread];
+    const Fr* thread_scalars = &scalars[thread_index * num_initial_points_per_thread];
+    bool* skew_table = &input_skew_table[(2 * thread_index) * num_initial_points_per_thread];
+    uint64_t offset = thread_index * num_points_per_thread;
+
+    for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
+        T0 = thread_scalars[j].from_montgomery_form();
+        Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
+
+        wnaf::fixed_wnaf_with_counts(&T0.data[0],
+                                     &wnaf_table[(j << 1UL)],
+                                     skew_table[j << 1ULL],
+                                     thread_round_counts,
+                                     ((j << 1ULL) + offset) << 32ULL,
+                                     num_points,
+                                     wnaf_bits);
+        wnaf::fixed_wnaf_with_counts(&T0.data[2],
+                                     &wnaf_table[(j << 1UL) + 1],
+                                     skew_table[(j << 1UL) + 1],
+                                     thread_round_counts,
+                                     ((j << 1UL) + offset + 1) << 32UL,
+                                     num_points,
+                                     wnaf_bits);
+    }
+}
+
 /**
  * Compute the windowed-non-adjacent-form versions of our scalar multipliers.
  *
@@ -201,7 +254,6 @@ void compute_wnaf_states(uint64_t* point_schedule,
                          const typename Curve::ScalarField* scalars,
                          const size_t num_initial_points)
 {
-    using Fr = typename Curve::ScalarField;
     const size_t num_points = num_initial_points * 2;
     constexpr size_t MAX_NUM_ROUNDS = 256;
     constexpr size_t MAX_NUM_THREADS = 128;
@@ -209,8 +261,6 @@ void compute_wnaf_states(uint64_t* point_schedule,
     const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
     const size_t wnaf_bits = bits_per_bucket + 1;
     const size_t num_threads = get_num_cpus_pow2();
-    const size_t num_initial_points_per_thread = num_initial_points / num_threads;
-    const size_t num_points_per_thread = num_points / num_threads;
     std::array<std::array<uint64_t, MAX_NUM_ROUNDS>, MAX_NUM_THREADS> thread_round_counts;
     for (size_t i = 0; i < num_threads; ++i) {
         for (size_t j = 0; j < num_rounds; ++j) {
@@ -219,31 +269,8 @@ void compute_wnaf_states(uint64_t* point_schedule,
     }
 
     parallel_for(num_threads, [&](size_t i) {
-        Fr T0;
-        uint64_t* wnaf_table = &point_schedule[(2 * i) * num_initial_points_per_thread];
-        const Fr* thread_scalars = &scalars[i * num_initial_points_per_thread];
-        bool* skew_table = &input_skew_table[(2 * i) * num_initial_points_per_thread];
-        uint64_t offset = i * num_points_per_thread;
-
-        for (uint64_t j = 0; j < num_initial_points_per_thread; ++j) {
-            T0 = thread_scalars[j].from_montgomery_form();
-            Fr::split_into_endomorphism_scalars(T0, T0, *(Fr*)&T0.data[2]);
-
-            wnaf::fixed_wnaf_with_counts(&T0.data[0],
-                                         &wnaf_table[(j << 1UL)],
-                                         skew_table[j << 1ULL],
-                                         &thread_round_counts[i][0],
-                                         ((j << 1ULL) + offset) << 32ULL,
-                                         num_points,
-                                         wnaf_bits);
-            wnaf::fixed_wnaf_with_counts(&T0.data[2],
-                                         &wnaf_table[(j << 1UL) + 1],
-                                         skew_table[(j << 1UL) + 1],
-                                         &thread_round_counts[i][0],
-                                         ((j << 1UL) + offset + 1) << 32UL,
-                                         num_points,
-                                         wnaf_bits);
-        }
+        compute_thread_wnaf_states<Curve>(
+            point_schedule, input_skew_table, &thread_round_counts[i][0], scalars, num_initial_points, i, wnaf_bits);
     });
 
     for (size_t i = 0; i < num_rounds; ++i) {
@@ -737,6 +764,88 @@ uint32_t construct_addition_chains(affine_product_runtime_state<Curve>& state, b
     return max_bucket_bits;
 }
 
+/**
+ * Evaluates the contribution of thread `thread_index` to pippenger round `round`.
+ * The thread takes a contiguous slice of the (bucket-sorted) round schedule, reduces its buckets via the affine
+ * trick and concatenates them into a single point.
+ **/
+template <typename Curve>
+typename Curve::Element evaluate_pippenger_round_for_thread(pippenger_runtime_state<Curve>& state,
+                                                            uint64_t* round_schedule,
+                                                            const uint64_t num_round_points,
+                                                            typename Curve::AffineElement* points,
+                                                            const size_t thread_index,
+                                                            bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_threads = get_num_cpus_pow2();
+    const size_t j = thread_index;
+
+    Element accumulator;
+    accumulator.self_set_infinity();
+
+    if ((num_round_points == 0) || (num_round_points < num_threads && j != num_threads - 1)) {
+        return accumulator;
+    }
+
+    const uint64_t num_round_points_per_thread = num_round_points / num_threads;
+    const uint64_t leftovers =
+        (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
+
+    uint64_t* thread_point_schedule = &round_schedule[j * num_round_points_per_thread];
+    const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
+    const size_t last_bucket = thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
+    const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
+
+    affine_product_runtime_state<Curve> product_state = state.get_affine_product_runtime_state(num_threads, j);
+    product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
+    product_state.points = points;
+    product_state.point_schedule = thread_point_schedule;
+    product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
+    AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
+    Element running_sum;
+    running_sum.self_set_infinity();
+
+    // one nice side-effect of the affine trick, is that half of the bucket concatenation
+    // algorithm can use mixed addition formulae, instead of full addition formulae
+    size_t output_it = product_state.num_points - 1;
+    for (size_t k = num_thread_buckets - 1; k > 0; --k) {
+        if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
+            running_sum += (output_buckets[output_it]);
+            --output_it;
+        }
+        accumulator += running_sum;
+    }
+    running_sum += output_buckets[0];
+    accumulator.self_dbl();
+    accumulator += running_sum;
+
+    // we now need to scale up 'running sum' up to the value of the first bucket.
+    // e.g. if first bucket is 0, no scaling
+    // if first bucket is 1, we need to add (2 * running_sum)
+    if (first_bucket > 0) {
+        auto multiplier = static_cast<uint32_t>(first_bucket << 1UL);
+        size_t shift = numeric::get_msb(multiplier);
+        Element rolling_accumulator = Curve::Group::point_at_infinity;
+        bool init = false;
+        while (shift != static_cast<size_t>(-1)) {
+            if (init) {
+                rolling_accumulator.self_dbl();
+                if (((multiplier >> shift) & 1)) {
+                    rolling_accumulator += running_sum;
+                }
+            } else {
+                rolling_accumulator += running_sum;
+            }
+            init = true;
+            shift -= 1;
+        }
+        accumulator += rolling_accumulator;
+    }
+    return accumulator;
+}
+
 template <typename Curve>
 typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>& state,
                                                   typename Curve::AffineElement* points,
@@ -757,72 +866,8 @@ typename Curve::Element evaluate_pippenger_rounds(pippenger_runtime_state<Curve>
 
         for (size_t i = 0; i < num_rounds; ++i) {
 
-            const uint64_t num_round_points = state.round_counts[i];
-
-            Element accumulator;
-            accumulator.self_set_infinity();
-
-            if ((num_round_points == 0) || (num_round_points < num_threads && j != num_threads - 1)) {
-            } else {
-
-                const uint64_t num_round_points_per_thread = num_round_points / num_threads;
-                const uint64_t leftovers =
-                    (j == num_threads - 1) ? (num_round_points) - (num_round_points_per_thread * num_threads) : 0;
-
-                uint64_t* thread_point_schedule =
-                    &state.point_schedule[(i * num_points) + j * num_round_points_per_thread];
-                const size_t first_bucket = thread_point_schedule[0] & 0x7fffffffU;
-                const size_t last_bucket =
-                    thread_point_schedule[(num_round_points_per_thread - 1 + leftovers)] & 0x7fffffffU;
-                const size_t num_thread_buckets = (last_bucket - first_bucket) + 1;
-
-                affine_product_runtime_state<Curve> product_state =
-                    state.get_affine_product_runtime_state(num_threads, j);
-                product_state.num_points = static_cast<uint32_t>(num_round_points_per_thread + leftovers);
-                product_state.points = points;
-                product_state.point_schedule = thread_point_schedule;
-                product_state.num_buckets = static_cast<uint32_t>(num_thread_buckets);
-                AffineElement* output_buckets = reduce_buckets(product_state, true, handle_edge_cases);
-                Element running_sum;
-                running_sum.self_set_infinity();
-
-                // one nice side-effect of the affine trick, is that half of the bucket concatenation
-                // algorithm can use mixed addition formulae, instead of full addition formulae
-                size_t output_it = product_state.num_points - 1;
-                for (size_t k = num_thread_buckets - 1; k > 0; --k) {
-                    if (__builtin_expect(!product_state.bucket_empty_status[k], 1)) {
-                        running_sum += (output_buckets[output_it]);
-                        --output_it;
-                    }
-                    accumulator += running_sum;
-                }
-                running_sum += output_buckets[0];
-                accumulator.self_dbl();
-                accumulator += running_sum;
-
-                // we now need to scale up 'running sum' up to the value of the first bucket.
-                // e.g. if first bucket is 0, no scaling
-                // if first bucket is 1, we need to add (2 * running_sum)
-                if (first_bucket > 0) {
-                    auto multiplier = static_cast<uint32_t>(first_bucket << 1UL);
-                    size_t shift = numeric::get_msb(multiplier);
-                    Element rolling_accumulator = Curve::Group::point_at_infinity;
-                    bool init = false;
-                    while (shift != static_cast<size_t>(-1)) {
-                        if (init) {
-                            rolling_accumulator.self_dbl();
-                            if (((multiplier >> shift) & 1)) {
-                                rolling_accumulator += running_sum;
-                            }
-                        } else {
-                            rolling_accumulator += running_sum;
-                        }
-                        init = true;
-                        shift -= 1;
-                    }
-                    accumulator += rolling_accumulator;
-                }
-            }
+            Element accumulator = evaluate_pippenger_round_for_thread<Curve>(
+                state, &state.point_schedule[i * num_points], state.round_counts[i], points, j, handle_edge_cases);
 
             if (i == (num_rounds - 1)) {
                 const size_t num_points_per_thread = num_points / num_threads;
@@ -955,6 +1000,372 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
     return pippenger(scalars, &G_mod[0], num_initial_points, state, false);
 }
 
+/**
+ * Allocates (but does not populate) a fixed-base point table for `num_points` SRS points.
+ * The window size is the one pippenger picks for the largest power-of-two slice of `num_points`, as that is the
+ * slice size used when committing to a full-size polynomial.
+ * The unscaled SRS points should be written to `get_point_table()`, before calling `generate_fixed_base_point_table`.
+ **/
+template <typename Curve> fixed_base_point_table<Curve> alloc_fixed_base_point_table(const size_t num_points)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const auto num_slice_points = static_cast<size_t>(1ULL << numeric::get_msb(static_cast<uint64_t>(num_points)));
+
+    fixed_base_point_table<Curve> table;
+    table.num_points = num_points;
+    table.bits_per_bucket = get_optimal_bucket_width(num_slice_points);
+    table.num_rounds = get_num_rounds(num_slice_points * 2);
+    table.round_stride = point_table_size(num_points);
+    table.points = std::static_pointer_cast<AffineElement[]>(
+        get_mem_slab(table.num_rounds * table.round_stride * sizeof(AffineElement)));
+    return table;
+}
+
+/**
+ * Expands the SRS points stored in `table.get_point_table()` into a pippenger point table (see
+ * `generate_pippenger_point_table`), then fills in the scaled copies used by the earlier pippenger rounds.
+ * Each copy is the next one doubled `bits_per_bucket + 1` times, normalised with a batch inversion.
+ **/
+template <typename Curve> void generate_fixed_base_point_table(fixed_base_point_table<Curve>& table)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    generate_pippenger_point_table<Curve>(table.get_point_table(), table.get_point_table(), table.num_points);
+
+    const size_t num_table_points = table.num_points * 2;
+    const size_t num_doublings = table.bits_per_bucket + 1;
+    const size_t num_threads = get_num_cpus();
+    const size_t points_per_thread = (num_table_points + num_threads - 1) / num_threads;
+
+    parallel_for(num_threads, [&](size_t thread_index) {
+        const size_t start = thread_index * points_per_thread;
+        const size_t end = std::min(start + points_per_thread, num_table_points);
+        if (start >= end) {
+            return;
+        }
+        std::vector<Element> temporaries(end - start);
+        for (size_t round = table.num_rounds - 1; round > 0; --round) {
+            const AffineElement* source = table.get_round_points(round);
+            AffineElement* destination = table.get_round_points(round - 1);
+            for (size_t i = start; i < end; ++i) {
+                Element& temporary = temporaries[i - start];
+                temporary = Element(source[i]);
+                for (size_t j = 0; j < num_doublings; ++j) {
+                    temporary.self_dbl();
+                }
+            }
+            Element::batch_normalize(&temporaries[0], end - start);
+            for (size_t i = start; i < end; ++i) {
+                destination[i] = AffineElement(temporaries[i - start].x, temporaries[i - start].y);
+            }
+        }
+    });
+}
+
+/**
+ * Fixed-base counterpart of `pippenger_internal`. `point_offset` is the index (in the SRS) of the first point.
+ *
+ * Every round reads its points from the matching scaled table, so the round results are simply summed; there is no
+ * doubling phase between the rounds.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_internal(typename Curve::ScalarField* scalars,
+                                                      const fixed_base_point_table<Curve>& table,
+                                                      const size_t point_offset,
+                                                      const size_t num_initial_points,
+                                                      pippenger_runtime_state<Curve>& state,
+                                                      bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_rounds = get_num_rounds(num_points);
+    const size_t num_threads = get_num_cpus_pow2();
+
+    compute_wnaf_states<Curve>(state.point_schedule, state.skew_table, state.round_counts, scalars, num_initial_points);
+    organize_buckets(state.point_schedule, num_points);
+
+    std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
+        static_cast<Element*>(aligned_alloc(64, num_threads * sizeof(Element))), &aligned_free);
+
+    parallel_for(num_threads, [&](size_t j) {
+        thread_accumulators[j].self_set_infinity();
+
+        for (size_t i = 0; i < num_rounds; ++i) {
+            thread_accumulators[j] +=
+                evaluate_pippenger_round_for_thread<Curve>(state,
+                                                           &state.point_schedule[i * num_points],
+                                                           state.round_counts[i],
+                                                           table.get_round_points(i) + point_offset * 2,
+                                                           j,
+                                                           handle_edge_cases);
+        }
+
+        const size_t num_points_per_thread = num_points / num_threads;
+        const bool* skew_table = &state.skew_table[j * num_points_per_thread];
+        const AffineElement* point_table = table.get_point_table() + point_offset * 2 + j * num_points_per_thread;
+        for (size_t k = 0; k < num_points_per_thread; ++k) {
+            if (skew_table[k]) {
+                thread_accumulators[j] += -point_table[k];
+            }
+        }
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (size_t i = 0; i < num_threads; ++i) {
+        result += thread_accumulators[i];
+    }
+    return result;
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_with_offset(typename Curve::ScalarField* scalars,
+                                                         const fixed_base_point_table<Curve>& table,
+                                                         const size_t point_offset,
+                                                         const size_t num_initial_points,
+                                                         pippenger_runtime_state<Curve>& state,
+                                                         bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    if (num_initial_points <= threshold) {
+        return pippenger(
+            scalars, table.get_point_table() + point_offset * 2, num_initial_points, state, handle_edge_cases);
+    }
+
+    const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
+    const auto num_slice_points = static_cast<size_t>(1ULL << slice_bits);
+
+    // The scaled tables are only valid for the window size they were built for. Slices with a different window fall
+    // back to the variable-base algorithm over the unscaled table.
+    Element result;
+    if (get_optimal_bucket_width(num_slice_points) == table.bits_per_bucket &&
+        state.num_buckets >= (1ULL << table.bits_per_bucket)) {
+        result = pippenger_fixed_base_internal(
+            scalars, table, point_offset, num_slice_points, state, handle_edge_cases);
+    } else {
+        result = pippenger_internal(
+            table.get_point_table() + point_offset * 2, scalars, num_slice_points, state, handle_edge_cases);
+    }
+
+    if (num_slice_points != num_initial_points) {
+        return result + pippenger_fixed_base_with_offset(scalars + num_slice_points,
+                                                         table,
+                                                         point_offset + num_slice_points,
+                                                         num_initial_points - num_slice_points,
+                                                         state,
+                                                         handle_edge_cases);
+    }
+    return result;
+}
+
+/**
+ * Multi-scalar multiplication of `scalars` against the first `num_initial_points` points of a fixed-base table.
+ * Computes the same result as `pippenger` on `table.get_point_table()`, but skips the doubling phase.
+ **/
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base(typename Curve::ScalarField* scalars,
+                                             const fixed_base_point_table<Curve>& table,
+                                             const size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state,
+                                             bool handle_edge_cases)
+{
+    ASSERT(num_initial_points <= table.num_points);
+    if (num_initial_points == 0) {
+        typename Curve::Element out = Curve::Group::one;
+        out.self_set_infinity();
+        return out;
+    }
+    return pippenger_fixed_base_with_offset(scalars, table, 0, num_initial_points, state, handle_edge_cases);
+}
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_unsafe(typename Curve::ScalarField* scalars,
+                                                    const fixed_base_point_table<Curve>& table,
+                                                    const size_t num_initial_points,
+                                                    pippenger_runtime_state<Curve>& state)
+{
+    return pippenger_fixed_base(scalars, table, num_initial_points, state, false);
+}
+
+/**
+ * Evaluates `scalars.size()` multi-scalar multiplications that share the same point table, in a single pass.
+ *
+ * Compared to calling `pippenger_internal` once per scalar vector, the WNAF computation, the bucket sort and the round
+ * evaluation of every MSM are each dispatched in one `parallel_for`. Within a round, a thread evaluates its slice of
+ * every MSM's schedule back-to-back, so the points it touches are shared between MSMs while still resident in cache,
+ * and the final skew correction streams each thread's tranche of the point table once for all MSMs.
+ *
+ * `state` provides the per-thread bucket scratch space; the point schedules and skew tables for the batch are
+ * allocated here (one per MSM).
+ **/
+template <typename Curve>
+void pippenger_batch_internal(std::span<typename Curve::ScalarField* const> scalars,
+                              typename Curve::AffineElement* points,
+                              const size_t num_initial_points,
+                              pippenger_runtime_state<Curve>& state,
+                              bool handle_edge_cases,
+                              typename Curve::Element* results)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    constexpr size_t MAX_NUM_ROUNDS = pippenger_runtime_state<Curve>::MAX_NUM_ROUNDS;
+
+    const size_t num_msms = scalars.size();
+    const size_t num_points = num_initial_points * 2;
+    const size_t num_rounds = get_num_rounds(num_points);
+    const size_t num_threads = get_num_cpus_pow2();
+    const size_t bits_per_bucket = get_optimal_bucket_width(num_initial_points);
+    const size_t wnaf_bits = bits_per_bucket + 1;
+    const size_t schedule_size = num_points * num_rounds;
+
+    // The trailing overflow absorbs the look-ahead prefetches made by `reduce_buckets`
+    std::shared_ptr<void> schedule_slab =
+        get_mem_slab((num_msms * schedule_size + state.prefetch_overflow) * sizeof(uint64_t));
+    auto* point_schedules = static_cast<uint64_t*>(schedule_slab.get());
+    std::unique_ptr<bool[], decltype(&aligned_free)> skew_tables(
+        static_cast<bool*>(aligned_alloc(64, pad(num_msms * num_points * sizeof(bool), 64))), &aligned_free);
+    std::vector<uint64_t> thread_round_counts(num_msms * num_threads * MAX_NUM_ROUNDS, 0);
+    std::vector<uint64_t> round_counts(num_msms * MAX_NUM_ROUNDS, 0);
+
+    parallel_for(num_threads, [&](size_t i) {
+        for (size_t k = 0; k < num_msms; ++k) {
+            compute_thread_wnaf_states<Curve>(&point_schedules[k * schedule_size],
+                                              &skew_tables[k * num_points],
+                                              &thread_round_counts[(k * num_threads + i) * MAX_NUM_ROUNDS],
+                                              scalars[k],
+                                              num_initial_points,
+                                              i,
+                                              wnaf_bits);
+        }
+    });
+    for (size_t k = 0; k < num_msms; ++k) {
+        for (size_t i = 0; i < num_threads; ++i) {
+            for (size_t j = 0; j < num_rounds; ++j) {
+                round_counts[k * MAX_NUM_ROUNDS + j] += thread_round_counts[(k * num_threads + i) * MAX_NUM_ROUNDS + j];
+            }
+        }
+    }
+
+    // sort every round of every msm in one go; this gives `num_msms` times more independent work to spread over
+    // the threads than `organize_buckets` has
+    parallel_for(num_msms * num_rounds, [&](size_t i) {
+        scalar_multiplication::process_buckets(
+            &point_schedules[i * num_points], num_points, static_cast<uint32_t>(bits_per_bucket) + 1);
+    });
+
+    std::unique_ptr<Element[], decltype(&aligned_free)> thread_accumulators(
+        static_cast<Element*>(aligned_alloc(64, num_msms * num_threads * sizeof(Element))), &aligned_free);
+
+    parallel_for(num_threads, [&](size_t j) {
+        Element* accumulators = &thread_accumulators[j * num_msms];
+        for (size_t k = 0; k < num_msms; ++k) {
+            accumulators[k].self_set_infinity();
+        }
+
+        for (size_t i = 0; i < num_rounds; ++i) {
+            for (size_t k = 0; k < num_msms; ++k) {
+                Element accumulator =
+                    evaluate_pippenger_round_for_thread<Curve>(state,
+                                                               &point_schedules[k * schedule_size + i * num_points],
+                                                               round_counts[k * MAX_NUM_ROUNDS + i],
+                                                               points,
+                                                               j,
+                                                               handle_edge_cases);
+                if (i > 0) {
+                    for (size_t b = 0; b < bits_per_bucket + 1; ++b) {
+                        accumulators[k].self_dbl();
+                    }
+                }
+                accumulators[k] += accumulator;
+            }
+        }
+
+        // skew correction: a single sweep over this thread's tranche of points serves every msm
+        const size_t num_points_per_thread = num_points / num_threads;
+        const AffineElement* point_table = &points[j * num_points_per_thread];
+        for (size_t p = 0; p < num_points_per_thread; ++p) {
+            const AffineElement negated_point = -point_table[p];
+            for (size_t k = 0; k < num_msms; ++k) {
+                if (skew_tables[k * num_points + j * num_points_per_thread + p]) {
+                    accumulators[k] += negated_point;
+                }
+            }
+        }
+    });
+
+    for (size_t k = 0; k < num_msms; ++k) {
+        results[k].self_set_infinity();
+        for (size_t j = 0; j < num_threads; ++j) {
+            results[k] += thread_accumulators[j * num_msms + k];
+        }
+    }
+}
+
+/**
+ * Batched variant of `pippenger`: computes one MSM per entry of `scalars`, all against the same `points` (which must
+ * be a pippenger point table, i.e. the output of `generate_pippenger_point_table`).
+ *
+ * Every scalar vector must hold `num_initial_points` elements. `state` must have been constructed for at least
+ * `num_initial_points` points; it is shared by all MSMs in the batch.
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(std::span<typename Curve::ScalarField* const> scalars,
+                                                     typename Curve::AffineElement* points,
+                                                     const size_t num_initial_points,
+                                                     pippenger_runtime_state<Curve>& state,
+                                                     bool handle_edge_cases)
+{
+    using Element = typename Curve::Element;
+    using Fr = typename Curve::ScalarField;
+
+    const size_t num_msms = scalars.size();
+    std::vector<Element> results(num_msms);
+
+    // Same fallbacks as `pippenger`: tiny inputs are not worth batching.
+    const size_t threshold = get_num_cpus_pow2() * 8;
+    if (num_msms == 1 || num_initial_points <= threshold) {
+        for (size_t k = 0; k < num_msms; ++k) {
+            results[k] = pippenger(scalars[k], points, num_initial_points, state, handle_edge_cases);
+        }
+        return results;
+    }
+
+    const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
+    const auto num_slice_points = static_cast<size_t>(1ULL << slice_bits);
+
+    pippenger_batch_internal(scalars, points, num_slice_points, state, handle_edge_cases, &results[0]);
+
+    if (num_slice_points != num_initial_points) {
+        const size_t leftover_points = num_initial_points - num_slice_points;
+        std::vector<Fr*> leftover_scalars(num_msms);
+        for (size_t k = 0; k < num_msms; ++k) {
+            leftover_scalars[k] = scalars[k] + num_slice_points;
+        }
+        std::vector<Element> leftover_results = pippenger_batch<Curve>(
+            leftover_scalars, points + (num_slice_points * 2), leftover_points, state, handle_edge_cases);
+        for (size_t k = 0; k < num_msms; ++k) {
+            results[k] += leftover_results[k];
+        }
+    }
+    return results;
+}
+
+/**
+ * Batched `pippenger_unsafe`. Same caveats apply: prover only!
+ **/
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(std::span<typename Curve::ScalarField* const> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            const size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state)
+{
+    return pippenger_batch(scalars, points, num_initial_points, state, false);
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(curve::BN254::AffineElement* points,
@@ -1007,6 +1418,34 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template fixed_base_point_table<curve::BN254> alloc_fixed_base_point_table<curve::BN254>(size_t num_points);
+
+template void generate_fixed_base_point_table<curve::BN254>(fixed_base_point_table<curve::BN254>& table);
+
+template curve::BN254::Element pippenger_fixed_base<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                              const fixed_base_point_table<curve::BN254>& table,
+                                                              size_t num_initial_points,
+                                                              pippenger_runtime_state<curve::BN254>& state,
+                                                              bool handle_edge_cases);
+
+template curve::BN254::Element pippenger_fixed_base_unsafe<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                     const fixed_base_point_table<curve::BN254>& table,
+                                                                     size_t num_initial_points,
+                                                                     pippenger_runtime_state<curve::BN254>& state);
+
+template std::vector<curve::BN254::Element> pippenger_batch<curve::BN254>(
+    std::span<curve::BN254::ScalarField* const> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state,
+    bool handle_edge_cases);
+
+template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<curve::BN254::ScalarField* const> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1058,6 +1497,36 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template fixed_base_point_table<curve::Grumpkin> alloc_fixed_base_point_table<curve::Grumpkin>(size_t num_points);
+
+template void generate_fixed_base_point_table<curve::Grumpkin>(fixed_base_point_table<curve::Grumpkin>& table);
+
+template curve::Grumpkin::Element pippenger_fixed_base<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& table,
+    size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases);
+
+template curve::Grumpkin::Element pippenger_fixed_base_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& table,
+    size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+template std::vector<curve::Grumpkin::Element> pippenger_batch<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField* const> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases);
+
+template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField* const> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 } // namespace barretenberg::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
@@ -5,6 +5,9 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
 
 namespace barretenberg::scalar_multiplication {
 
@@ -85,6 +88,29 @@ template <typename Curve> struct multiplication_thread_state {
     const uint64_t* point_schedule;
 };
 
+/**
+ * A point table for fixed-base multi-scalar multiplications (i.e. commitments against the SRS).
+ *
+ * `points` holds `num_rounds` pippenger point tables back to back, `round_stride` elements apart. Table `i` contains
+ * the pippenger point table scaled by 2^{(num_rounds - 1 - i) * (bits_per_bucket + 1)}, so that pippenger round `i`
+ * can add its points straight into the final result instead of having the preceding rounds doubled up to its weight.
+ * The last table is the unscaled pippenger point table and can be handed to the variable-base algorithm.
+ *
+ * The table costs `num_rounds` times the memory of a regular pippenger point table (e.g. 8x for 2^20 points).
+ */
+template <typename Curve> struct fixed_base_point_table {
+    using AffineElement = typename Curve::AffineElement;
+
+    size_t num_points = 0;
+    size_t bits_per_bucket = 0;
+    size_t num_rounds = 0;
+    size_t round_stride = 0;
+    std::shared_ptr<AffineElement[]> points;
+
+    AffineElement* get_round_points(const size_t round) const { return points.get() + round * round_stride; }
+    AffineElement* get_point_table() const { return get_round_points(num_rounds - 1); }
+};
+
 template <typename Curve>
 void compute_wnaf_states(uint64_t* point_schedule,
                          bool* input_skew_table,
@@ -170,6 +196,36 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(typename Cur
                                                                     size_t num_initial_points,
                                                                     pippenger_runtime_state<Curve>& state);
 
+template <typename Curve> fixed_base_point_table<Curve> alloc_fixed_base_point_table(size_t num_points);
+
+template <typename Curve> void generate_fixed_base_point_table(fixed_base_point_table<Curve>& table);
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base(typename Curve::ScalarField* scalars,
+                                             const fixed_base_point_table<Curve>& table,
+                                             size_t num_initial_points,
+                                             pippenger_runtime_state<Curve>& state,
+                                             bool handle_edge_cases = true);
+
+template <typename Curve>
+typename Curve::Element pippenger_fixed_base_unsafe(typename Curve::ScalarField* scalars,
+                                                    const fixed_base_point_table<Curve>& table,
+                                                    size_t num_initial_points,
+                                                    pippenger_runtime_state<Curve>& state);
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch(std::span<typename Curve::ScalarField* const> scalars,
+                                                     typename Curve::AffineElement* points,
+                                                     size_t num_initial_points,
+                                                     pippenger_runtime_state<Curve>& state,
+                                                     bool handle_edge_cases = true);
+
+template <typename Curve>
+std::vector<typename Curve::Element> pippenger_batch_unsafe(std::span<typename Curve::ScalarField* const> scalars,
+                                                            typename Curve::AffineElement* points,
+                                                            size_t num_initial_points,
+                                                            pippenger_runtime_state<Curve>& state);
+
 // Explicit instantiation
 // BN254
 
@@ -223,6 +279,35 @@ extern template curve::BN254::Element pippenger_without_endomorphism_basis_point
     const size_t num_initial_points,
     pippenger_runtime_state<curve::BN254>& state);
 
+extern template fixed_base_point_table<curve::BN254> alloc_fixed_base_point_table<curve::BN254>(size_t num_points);
+
+extern template void generate_fixed_base_point_table<curve::BN254>(fixed_base_point_table<curve::BN254>& table);
+
+extern template curve::BN254::Element pippenger_fixed_base<curve::BN254>(curve::BN254::ScalarField* scalars,
+                                                                     const fixed_base_point_table<curve::BN254>& table,
+                                                                     size_t num_initial_points,
+                                                                     pippenger_runtime_state<curve::BN254>& state,
+                                                                     bool handle_edge_cases = true);
+
+extern template curve::BN254::Element pippenger_fixed_base_unsafe<curve::BN254>(
+    curve::BN254::ScalarField* scalars,
+    const fixed_base_point_table<curve::BN254>& table,
+    size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
+extern template std::vector<curve::BN254::Element> pippenger_batch<curve::BN254>(
+    std::span<curve::BN254::ScalarField* const> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state,
+    bool handle_edge_cases = true);
+
+extern template std::vector<curve::BN254::Element> pippenger_batch_unsafe<curve::BN254>(
+    std::span<curve::BN254::ScalarField* const> scalars,
+    curve::BN254::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 // Grumpkin
 
 extern template void generate_pippenger_point_table<curve::Grumpkin>(curve::Grumpkin::AffineElement* points,
@@ -277,4 +362,35 @@ extern template curve::Grumpkin::Element pippenger_without_endomorphism_basis_po
     const size_t num_initial_points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+extern template fixed_base_point_table<curve::Grumpkin> alloc_fixed_base_point_table<curve::Grumpkin>(
+    size_t num_points);
+
+extern template void generate_fixed_base_point_table<curve::Grumpkin>(fixed_base_point_table<curve::Grumpkin>& table);
+
+extern template curve::Grumpkin::Element pippenger_fixed_base<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& table,
+    size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases = true);
+
+extern template curve::Grumpkin::Element pippenger_fixed_base_unsafe<curve::Grumpkin>(
+    curve::Grumpkin::ScalarField* scalars,
+    const fixed_base_point_table<curve::Grumpkin>& table,
+    size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
+extern template std::vector<curve::Grumpkin::Element> pippenger_batch<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField* const> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state,
+    bool handle_edge_cases = true);
+
+extern template std::vector<curve::Grumpkin::Element> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<curve::Grumpkin::ScalarField* const> scalars,
+    curve::Grumpkin::AffineElement* points,
+    const size_t num_initial_points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 } // namespace barretenberg::scalar_multiplication
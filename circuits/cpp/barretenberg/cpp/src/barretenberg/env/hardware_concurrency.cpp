@@ -1,5 +1,14 @@
 #include "hardware_concurrency.hpp"
 #include <thread>
+#ifdef __linux__
+#include <algorithm>
+#include <cctype>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#endif
 
 extern "C" {
 
@@ -7,4 +16,63 @@ uint32_t env_hardware_concurrency()
 {
     return std::thread::hardware_concurrency();
 }
-}
\ No newline at end of file
+}
+
+#ifdef __linux__
+namespace {
+// Parses a kernel cpu list such as "0-15,32-47".
+std::vector<uint32_t> parse_cpu_list(const std::string& cpu_list)
+{
+    std::vector<uint32_t> cpus;
+    std::stringstream stream(cpu_list);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n") {
+            continue;
+        }
+        const auto dash = range.find('-');
+        const auto first = static_cast<uint32_t>(std::stoul(range.substr(0, dash)));
+        const auto last = dash == std::string::npos ? first : static_cast<uint32_t>(std::stoul(range.substr(dash + 1)));
+        for (uint32_t cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+} // namespace
+#endif
+
+std::vector<std::vector<uint32_t>> env_numa_topology()
+{
+    std::vector<std::vector<uint32_t>> nodes;
+#ifdef __linux__
+    try {
+        const std::filesystem::path node_dir("/sys/devices/system/node");
+        for (const auto& entry : std::filesystem::directory_iterator(node_dir)) {
+            const auto name = entry.path().filename().string();
+            if (name.rfind("node", 0) != 0 || name.size() == 4 ||
+                !std::all_of(name.begin() + 4, name.end(), [](char c) { return std::isdigit(c) != 0; })) {
+                continue;
+            }
+            std::ifstream cpu_list_file(entry.path() / "cpulist");
+            std::string cpu_list;
+            std::getline(cpu_list_file, cpu_list);
+            const auto node = std::stoul(name.substr(4));
+            if (node >= nodes.size()) {
+                nodes.resize(node + 1);
+            }
+            nodes[node] = parse_cpu_list(cpu_list);
+        }
+    } catch (const std::exception&) {
+        nodes.clear();
+    }
+#endif
+    if (nodes.empty()) {
+        std::vector<uint32_t> cpus(env_hardware_concurrency());
+        for (uint32_t i = 0; i < cpus.size(); ++i) {
+            cpus[i] = i;
+        }
+        nodes.push_back(std::move(cpus));
+    }
+    return nodes;
+}
@@ -1,4 +1,11 @@
 #pragma once
 #include <cstdint>
+#include <vector>
 
-extern "C" uint32_t env_hardware_concurrency();
\ No newline at end of file
+extern "C" uint32_t env_hardware_concurrency();
+
+/**
+ * The cpus of each NUMA node on the host, indexed by node number, as listed in /sys/devices/system/node on Linux.
+ * Memory-only nodes have no cpus. Hosts without NUMA information report a single node holding every cpu.
+ */
+std::vector<std::vector<uint32_t>> env_numa_topology();
@@ -67,10 +67,46 @@ template <class Curve> class CommitmentKey {
     {
         const size_t degree = polynomial.size();
         ASSERT(degree <= srs->get_monomial_size());
+        if (const auto* fixed_base_table = srs->get_fixed_base_table()) {
+            return barretenberg::scalar_multiplication::pippenger_fixed_base_unsafe<Curve>(
+                const_cast<Fr*>(polynomial.data()), *fixed_base_table, degree, pippenger_runtime_state);
+        }
         return barretenberg::scalar_multiplication::pippenger_unsafe<Curve>(
             const_cast<Fr*>(polynomial.data()), srs->get_monomial_points(), degree, pippenger_runtime_state);
     };
 
+    /**
+     * @brief Commits to several polynomials of equal size with a single batched MSM over the SRS
+     *
+     * @param polynomials univariate polynomials p_k(X), all of the same size
+     * @return the commitments [p_k(x)], in the order given
+     */
+    std::vector<Commitment> batch_commit(std::span<const std::span<Fr>> polynomials)
+    {
+        if (polynomials.empty()) {
+            return {};
+        }
+        const size_t degree = polynomials[0].size();
+        ASSERT(degree <= srs->get_monomial_size());
+        // Fixed-base commitments already avoid the doublings the batched MSM amortises
+        if (srs->get_fixed_base_table() != nullptr) {
+            std::vector<Commitment> commitments;
+            for (const auto& polynomial : polynomials) {
+                ASSERT(polynomial.size() == degree);
+                commitments.push_back(commit(polynomial));
+            }
+            return commitments;
+        }
+        std::vector<Fr*> scalars;
+        for (const auto& polynomial : polynomials) {
+            ASSERT(polynomial.size() == degree);
+            scalars.push_back(polynomial.data());
+        }
+        auto results = barretenberg::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+            scalars, srs->get_monomial_points(), degree, pippenger_runtime_state);
+        return std::vector<Commitment>(results.begin(), results.end());
+    };
+
     barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> pippenger_runtime_state;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> srs;
 };
@@ -1,11 +1,17 @@
 #pragma once
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/honk/pcs/claim.hpp"
 #include "barretenberg/honk/transcript/transcript.hpp"
+#include <algorithm>
 #include <cstddef>
+#include <mutex>
 #include <numeric>
+#include <optional>
+#include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 /**
@@ -14,14 +20,96 @@
  *
  */
 namespace proof_system::honk::pcs::ipa {
+
+/**
+ * @brief A claim that the SRS folds into G_zero under the round challenges of an IPA proof, which is what is left of
+ * the proof's verification once its MSM over the SRS is deferred.
+ */
+template <typename Curve> struct FoldedGeneratorClaim {
+    std::vector<typename Curve::ScalarField> round_challenges;
+    typename Curve::AffineElement G_zero;
+};
+
 template <typename Curve> class IPA {
     using Fr = typename Curve::ScalarField;
     using GroupElement = typename Curve::Element;
     using Commitment = typename Curve::AffineElement;
     using CK = CommitmentKey<Curve>;
     using VK = VerifierCommitmentKey<Curve>;
+    using BaseField = typename Curve::BaseField;
     using Polynomial = barretenberg::Polynomial<Fr>;
 
+    // Vectors with fewer elements than this are processed on a single thread
+    static constexpr size_t GRAIN_SIZE = 64;
+
+    /**
+     * @brief Compute the inner products < a_vec_lo, b_vec_hi > and < a_vec_hi, b_vec_lo > of a round, each thread
+     * summing one chunk of the round.
+     */
+    static std::pair<Fr, Fr> compute_cross_inner_products(const Polynomial& a_vec,
+                                                          const std::vector<Fr>& b_vec,
+                                                          const size_t round_size)
+    {
+        Fr inner_prod_L = Fr::zero();
+        Fr inner_prod_R = Fr::zero();
+        std::mutex sum_mutex;
+        parallel_for_range(
+            round_size,
+            [&](size_t start, size_t end) {
+                Fr chunk_inner_prod_L = Fr::zero();
+                Fr chunk_inner_prod_R = Fr::zero();
+                for (size_t j = start; j < end; j++) {
+                    chunk_inner_prod_L += a_vec[j] * b_vec[round_size + j];
+                    chunk_inner_prod_R += a_vec[round_size + j] * b_vec[j];
+                }
+                std::lock_guard<std::mutex> lock(sum_mutex);
+                inner_prod_L += chunk_inner_prod_L;
+                inner_prod_R += chunk_inner_prod_R;
+            },
+            GRAIN_SIZE);
+        return { inner_prod_L, inner_prod_R };
+    }
+
+    /**
+     * @brief Fold the generators of a round as G_vec_lo + challenge_sqr * G_vec_hi, writing them to G_table.
+     *
+     * @details This is the fold G_vec_lo * challenge^{-1} + G_vec_hi * challenge without its common factor of
+     * challenge^{-1}, so only half of the points are multiplied by a scalar. Both G_vec and G_table are in pippenger
+     * point table form, and may be the same table: each chunk reads its points of the round before writing any.
+     *
+     * Each chunk multiplies its G_vec_hi points by challenge_sqr with a batched affine multiplication, interleaves them
+     * with its G_vec_lo points, and adds the pairs with one shared inversion. The sums land in the upper half of the
+     * chunk's pairs, from where they are expanded into G_table.
+     */
+    static void fold_generators(const Commitment* G_vec,
+                                Commitment* G_table,
+                                const size_t round_size,
+                                const Fr& challenge_sqr,
+                                std::vector<Commitment>& pairs,
+                                std::vector<BaseField>& scratch_space)
+    {
+        parallel_for_range(
+            round_size,
+            [&](size_t start, size_t end) {
+                const size_t num_points = end - start;
+                Commitment* chunk_pairs = &pairs[start * 2];
+                for (size_t j = 0; j < num_points; j++) {
+                    chunk_pairs[j] = G_vec[(round_size + start + j) * 2];
+                }
+                const auto G_hi = GroupElement::batch_mul_with_endomorphism(
+                    std::span<const Commitment>(chunk_pairs, num_points), challenge_sqr);
+                for (size_t j = 0; j < num_points; j++) {
+                    chunk_pairs[j * 2] = G_vec[(start + j) * 2];
+                    chunk_pairs[j * 2 + 1] = G_hi[j];
+                }
+                barretenberg::scalar_multiplication::add_affine_points_with_edge_cases<Curve>(
+                    chunk_pairs, num_points * 2, &scratch_space[start]);
+                barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                    &chunk_pairs[num_points], &G_table[start * 2], num_points);
+            },
+            GRAIN_SIZE);
+    }
+
   public:
     /**
      * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point
@@ -47,52 +135,54 @@ template <typename Curve> class IPA {
         ASSERT((poly_degree > 0) && (!(poly_degree & (poly_degree - 1))) &&
                "The poly_degree should be positive and a power of two");
 
+        // a_vec, b_vec and the generators are folded in place: each round's vectors occupy the first half of the
+        // previous round's, so nothing is allocated per round.
         auto a_vec = polynomial;
-        auto srs_elements = ck->srs->get_monomial_points();
-        std::vector<Commitment> G_vec_local(poly_degree);
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
-        }
         std::vector<Fr> b_vec(poly_degree);
-        Fr b_power = 1;
-        for (size_t i = 0; i < poly_degree; i++) {
-            b_vec[i] = b_power;
-            b_power *= opening_pair.challenge;
-        }
+        parallel_for_range(
+            poly_degree,
+            [&](size_t start, size_t end) {
+                Fr b_power = opening_pair.challenge.pow(start);
+                for (size_t i = start; i < end; i++) {
+                    b_vec[i] = b_power;
+                    b_power *= opening_pair.challenge;
+                }
+            },
+            GRAIN_SIZE);
+
+        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
+        // values at odd indices contain the point {srs[i-1].x * beta, -srs[i-1].y}, where beta is the endomorphism.
+        // The folded generators are kept in the same form, so the MSMs for L_i and R_i run on them directly. The first
+        // round reads the SRS itself, and folds it into G_table.
+        auto srs_elements = ck->srs->get_monomial_points();
+        std::vector<Commitment> G_table(poly_degree);
+        std::vector<Commitment> G_fold_pairs(poly_degree);
+        std::vector<BaseField> G_fold_scratch(poly_degree / 2);
+        Commitment* G_vec = srs_elements;
+        // The generators are folded without their factor of round_challenge_inv, which is collected in G_scale
+        // instead: the actual generators are G_scale * G_vec.
+        Fr G_scale = Fr::one();
+
         // Iterate for log(poly_degree) rounds to compute the round commitments.
         auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_degree));
         std::vector<GroupElement> L_elements(log_poly_degree);
         std::vector<GroupElement> R_elements(log_poly_degree);
         std::size_t round_size = poly_degree;
 
-        // TODO(#479): restructure IPA so it can be integrated with the pthread alternative to work queue (or even the
-        // work queue itself). Investigate whether parallelising parts of each rounds of IPA rounds brings significant
-        // improvements and see if reducing the size of G_vec_local and b_vec by taking the first iteration out of the
-        // loop can also be integrated.
         for (size_t i = 0; i < log_poly_degree; i++) {
             round_size >>= 1;
             // Compute inner_prod_L := < a_vec_lo, b_vec_hi > and inner_prod_R := < a_vec_hi, b_vec_lo >
-            Fr inner_prod_L = Fr::zero();
-            Fr inner_prod_R = Fr::zero();
-            for (size_t j = 0; j < round_size; j++) {
-                inner_prod_L += a_vec[j] * b_vec[round_size + j];
-                inner_prod_R += a_vec[round_size + j] * b_vec[j];
-            }
+            const auto [inner_prod_L, inner_prod_R] = compute_cross_inner_products(a_vec, b_vec, round_size);
+
             // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_elements[i] =
-                // TODO(#473)
-                barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                    &a_vec[0], &G_vec_local[round_size], round_size, ck->pippenger_runtime_state);
-            L_elements[i] += aux_generator * inner_prod_L;
+            L_elements[i] = barretenberg::scalar_multiplication::pippenger<Curve>(
+                &a_vec[0], &G_vec[round_size * 2], round_size, ck->pippenger_runtime_state, false);
+            L_elements[i] = L_elements[i] * G_scale + aux_generator * inner_prod_L;
 
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            // TODO(#473)
-            R_elements[i] = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                &a_vec[round_size], &G_vec_local[0], round_size, ck->pippenger_runtime_state);
-            R_elements[i] += aux_generator * inner_prod_R;
+            R_elements[i] = barretenberg::scalar_multiplication::pippenger<Curve>(
+                &a_vec[round_size], &G_vec[0], round_size, ck->pippenger_runtime_state, false);
+            R_elements[i] = R_elements[i] * G_scale + aux_generator * inner_prod_R;
 
             std::string index = std::to_string(i);
             transcript.send_to_verifier("IPA:L_" + index, Commitment(L_elements[i]));
@@ -102,22 +192,31 @@ template <typename Curve> class IPA {
             const Fr round_challenge = transcript.get_challenge("IPA:round_challenge_" + index);
             const Fr round_challenge_inv = round_challenge.invert();
 
-            std::vector<Commitment> G_lo(G_vec_local.begin(), G_vec_local.begin() + static_cast<long>(round_size));
-            std::vector<Commitment> G_hi(G_vec_local.begin() + static_cast<long>(round_size), G_vec_local.end());
-            G_lo = GroupElement::batch_mul_with_endomorphism(G_lo, round_challenge_inv);
-            G_hi = GroupElement::batch_mul_with_endomorphism(G_hi, round_challenge);
-
-            // Update the vectors a_vec, b_vec and G_vec.
+            // Update the vectors a_vec, b_vec and G_vec. Only a_vec is needed after the last round.
             // a_vec_next = a_vec_lo * round_challenge + a_vec_hi * round_challenge_inv
             // b_vec_next = b_vec_lo * round_challenge_inv + b_vec_hi * round_challenge
             // G_vec_next = G_vec_lo * round_challenge_inv + G_vec_hi * round_challenge
-            for (size_t j = 0; j < round_size; j++) {
-                a_vec[j] *= round_challenge;
-                a_vec[j] += round_challenge_inv * a_vec[round_size + j];
-                b_vec[j] *= round_challenge_inv;
-                b_vec[j] += round_challenge * b_vec[round_size + j];
-
-                G_vec_local[j] = G_lo[j] + G_hi[j];
+            const bool is_last_round = (i + 1 == log_poly_degree);
+            parallel_for_range(
+                round_size,
+                [&](size_t start, size_t end) {
+                    for (size_t j = start; j < end; j++) {
+                        a_vec[j] *= round_challenge;
+                        a_vec[j] += round_challenge_inv * a_vec[round_size + j];
+                    }
+                    if (is_last_round) {
+                        return;
+                    }
+                    for (size_t j = start; j < end; j++) {
+                        b_vec[j] *= round_challenge_inv;
+                        b_vec[j] += round_challenge * b_vec[round_size + j];
+                    }
+                },
+                GRAIN_SIZE);
+            if (!is_last_round) {
+                fold_generators(G_vec, &G_table[0], round_size, round_challenge.sqr(), G_fold_pairs, G_fold_scratch);
+                G_vec = &G_table[0];
+                G_scale *= round_challenge_inv;
             }
         }
 
@@ -136,10 +235,100 @@ template <typename Curve> class IPA {
     static bool verify(std::shared_ptr<VK> vk,
                        const OpeningClaim<Curve>& opening_claim,
                        VerifierTranscript<Fr>& transcript)
+    {
+        const auto reduced = reduce_rounds(vk, opening_claim, transcript);
+
+        // Compute G_zero = < s_vec, G_vec >, using the SRS stored in the commitment key as the pippenger point table
+        auto poly_degree = static_cast<size_t>(1) << reduced.round_challenges.size();
+        const std::vector<Fr> weights{ Fr::one() };
+        auto s_vec = compute_s_vec({ &reduced.round_challenges, 1 }, weights, poly_degree);
+        GroupElement G_zero = barretenberg::scalar_multiplication::pippenger<Curve>(
+            &s_vec[0], vk->srs->get_monomial_points(), poly_degree, vk->pippenger_runtime_state, false);
+
+        GroupElement right_hand_side =
+            G_zero * reduced.a_zero + reduced.aux_generator * reduced.a_zero * reduced.b_zero;
+
+        return (reduced.C_zero.normalize() == right_hand_side.normalize());
+    }
+
+    /**
+     * @brief Verify a proof up to its MSM over the SRS, returning the folded generator that MSM must produce
+     *
+     * @details The proof verifies if C_zero = a_zero * (G_zero + b_zero * aux_generator), so the G_zero it claims
+     * follows from C_zero without an MSM. What is left is to check that the SRS folds into that G_zero under the round
+     * challenges, which verify_folded_generator_claims does for many proofs with a single MSM.
+     *
+     * @return The claim left to check, or nullopt if a_zero is zero and no G_zero can be derived, in which case the
+     * proof is rejected (an honest proof has a_zero = 0 with negligible probability)
+     */
+    static std::optional<FoldedGeneratorClaim<Curve>> reduce_verification(std::shared_ptr<VK> vk,
+                                                                          const OpeningClaim<Curve>& opening_claim,
+                                                                          VerifierTranscript<Fr>& transcript)
+    {
+        auto reduced = reduce_rounds(vk, opening_claim, transcript);
+        if (reduced.a_zero.is_zero()) {
+            return std::nullopt;
+        }
+        GroupElement G_zero = reduced.C_zero * reduced.a_zero.invert() - reduced.aux_generator * reduced.b_zero;
+        return FoldedGeneratorClaim<Curve>{ std::move(reduced.round_challenges), Commitment(G_zero) };
+    }
+
+    /**
+     * @brief Check a batch of folded generator claims with one MSM over the SRS
+     *
+     * @details The claims are combined with random weights (the first weight is 1), so the check
+     * ∑ₘ wₘ⋅G_zeroₘ = < ∑ₘ wₘ⋅s_vecₘ, G_vec > fails with overwhelming probability if any claim is false. Claims may
+     * come from proofs of different degrees: a shorter s_vec covers a prefix of the SRS.
+     *
+     * @return true if every claim holds
+     */
+    static bool verify_folded_generator_claims(std::shared_ptr<VK> vk,
+                                               std::span<const FoldedGeneratorClaim<Curve>> claims)
+    {
+        if (claims.empty()) {
+            return true;
+        }
+        std::vector<std::vector<Fr>> round_challenges;
+        std::vector<Fr> weights;
+        size_t poly_degree = 1;
+        GroupElement claimed_sum = GroupElement::zero();
+        for (const auto& claim : claims) {
+            const Fr weight = weights.empty() ? Fr::one() : Fr::random_element();
+            round_challenges.push_back(claim.round_challenges);
+            weights.push_back(weight);
+            poly_degree = std::max(poly_degree, static_cast<size_t>(1) << claim.round_challenges.size());
+            claimed_sum += GroupElement(claim.G_zero) * weight;
+        }
+        auto s_vec = compute_s_vec(round_challenges, weights, poly_degree);
+        GroupElement G_sum = barretenberg::scalar_multiplication::pippenger<Curve>(
+            &s_vec[0], vk->srs->get_monomial_points(), poly_degree, vk->pippenger_runtime_state, false);
+
+        return (G_sum.normalize() == claimed_sum.normalize());
+    }
+
+  private:
+    /**
+     * @brief What remains of a proof once its rounds are checked: it verifies if
+     * C_zero = a_zero * (G_zero + b_zero * aux_generator), where G_zero is the SRS folded by the round challenges.
+     */
+    struct ReducedProof {
+        std::vector<Fr> round_challenges;
+        GroupElement C_zero;
+        Fr a_zero;
+        Fr b_zero;
+        Commitment aux_generator;
+    };
+
+    /**
+     * @brief Read the proof from the transcript, and compute C_zero and b_zero from it
+     */
+    static ReducedProof reduce_rounds(std::shared_ptr<VK> vk,
+                                      const OpeningClaim<Curve>& opening_claim,
+                                      VerifierTranscript<Fr>& transcript)
     {
         auto poly_degree = static_cast<size_t>(transcript.template receive_from_prover<uint64_t>("IPA:poly_degree"));
         Fr generator_challenge = transcript.get_challenge("IPA:generator_challenge");
-        auto aux_generator = Commitment::one() * generator_challenge;
+        Commitment aux_generator = Commitment::one() * generator_challenge;
 
         auto log_poly_degree = static_cast<size_t>(numeric::get_msb(poly_degree));
 
@@ -177,46 +366,80 @@ template <typename Curve> class IPA {
          * b_zero = g(evaluation) = ∏_{i ∈ [k]} (u_{k-i}^{-1} + u_{k-i}. (evaluation)^{2^{i-1}})
          */
         Fr b_zero = Fr::one();
+        Fr challenge_power = opening_claim.opening_pair.challenge;
         for (size_t i = 0; i < log_poly_degree; i++) {
-            auto exponent = static_cast<uint64_t>(Fr(2).pow(i));
             b_zero *= round_challenges_inv[log_poly_degree - 1 - i] +
-                      (round_challenges[log_poly_degree - 1 - i] * opening_claim.opening_pair.challenge.pow(exponent));
+                      (round_challenges[log_poly_degree - 1 - i] * challenge_power);
+            challenge_power.self_sqr();
         }
 
-        // Compute G_zero
-        // First construct s_vec
-        std::vector<Fr> s_vec(poly_degree);
-        for (size_t i = 0; i < poly_degree; i++) {
-            Fr s_vec_scalar = Fr::one();
-            for (size_t j = (log_poly_degree - 1); j != size_t(-1); j--) {
-                auto bit = (i >> j) & 1;
-                bool b = static_cast<bool>(bit);
-                if (b) {
-                    s_vec_scalar *= round_challenges[log_poly_degree - 1 - j];
-                } else {
-                    s_vec_scalar *= round_challenges_inv[log_poly_degree - 1 - j];
+        auto a_zero = transcript.template receive_from_prover<Fr>("IPA:a_0");
+
+        return { std::move(round_challenges), C_zero, a_zero, b_zero, aux_generator };
+    }
+
+    /**
+     * @brief Compute the weighted sum of the claims' challenge products, s_vec[i] = ∑ₘ wₘ⋅sₘ[i], where
+     * sₘ[i] = ∏_{j ∈ [k]} (u_j if bit k-1-j of i is set, u_j^{-1} otherwise) for the k round challenges u_j of claim m.
+     * The SRS folds into G_zero = < sₘ, G_vec >, and sₘ is zero beyond 2^k.
+     *
+     * @details Each product splits into a product over the high bits of i and one over the low bits, and the two
+     * depend on only 2^{k/2} values each. These are tabulated by doubling a table one challenge at a time, and each
+     * s_vec[i] then takes one multiplication per claim, computed in parallel: O(n) field operations where forming each
+     * product from all its k factors takes O(n log n).
+     */
+    static std::vector<Fr> compute_s_vec(std::span<const std::vector<Fr>> round_challenges,
+                                         std::span<const Fr> weights,
+                                         const size_t poly_degree)
+    {
+        struct ProductTables {
+            std::vector<Fr> high;
+            std::vector<Fr> low;
+            size_t num_low_bits;
+            size_t size;
+        };
+        // Each challenge doubles the table: entry i becomes entries 2i (times u_j^{-1}) and 2i + 1 (times u_j)
+        const auto tabulate = [](std::span<const Fr> challenges, const Fr& scale) {
+            std::vector<Fr> challenges_inv(challenges.begin(), challenges.end());
+            Fr::batch_invert(challenges_inv);
+            std::vector<Fr> table(static_cast<size_t>(1) << challenges.size());
+            table[0] = scale;
+            for (size_t j = 0; j < challenges.size(); j++) {
+                for (size_t i = (static_cast<size_t>(1) << j) - 1; i != size_t(-1); i--) {
+                    table[2 * i + 1] = table[i] * challenges[j];
+                    table[2 * i] = table[i] * challenges_inv[j];
                 }
             }
-            s_vec[i] = s_vec_scalar;
+            return table;
+        };
+        std::vector<ProductTables> tables;
+        for (size_t m = 0; m < round_challenges.size(); m++) {
+            std::span<const Fr> challenges = round_challenges[m];
+            const size_t num_high_bits = challenges.size() / 2;
+            const size_t num_low_bits = challenges.size() - num_high_bits;
+            tables.push_back({ tabulate(challenges.subspan(0, num_high_bits), weights[m]),
+                               tabulate(challenges.subspan(num_high_bits), Fr::one()),
+                               num_low_bits,
+                               static_cast<size_t>(1) << challenges.size() });
         }
-        auto srs_elements = vk->srs->get_monomial_points();
-        // Copy the G_vector to local memory.
-        std::vector<Commitment> G_vec_local(poly_degree);
-        // The SRS stored in the commitment key is the result after applying the pippenger point table so the
-        // values at odd indices contain the point {srs[i-1].x * beta, srs[i-1].y}, where beta is the endomorphism
-        // G_vec_local should use only the original SRS thus we extract only the even indices.
-        for (size_t i = 0; i < poly_degree * 2; i += 2) {
-            G_vec_local[i >> 1] = srs_elements[i];
-        }
-        // TODO(#473)
-        auto G_zero = barretenberg::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-            &s_vec[0], &G_vec_local[0], poly_degree, vk->pippenger_runtime_state);
 
-        auto a_zero = transcript.template receive_from_prover<Fr>("IPA:a_0");
-
-        GroupElement right_hand_side = G_zero * a_zero + aux_generator * a_zero * b_zero;
-
-        return (C_zero.normalize() == right_hand_side.normalize());
+        std::vector<Fr> s_vec(poly_degree);
+        parallel_for_range(
+            poly_degree,
+            [&](size_t start, size_t end) {
+                for (size_t i = start; i < end; i++) {
+                    Fr sum = Fr::zero();
+                    for (const auto& table : tables) {
+                        if (i < table.size) {
+                            const size_t low_mask = (static_cast<size_t>(1) << table.num_low_bits) - 1;
+                            sum += table.high[i >> table.num_low_bits] * table.low[i & low_mask];
+                        }
+                    }
+                    s_vec[i] = sum;
+                }
+            },
+            GRAIN_SIZE);
+        return s_vec;
     }
 };
 
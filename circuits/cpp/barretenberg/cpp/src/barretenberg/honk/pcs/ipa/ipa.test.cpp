@@ -82,6 +82,33 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript.get_manifest(), verifier_transcript.get_manifest());
 }
 
+TEST_F(IPATest, DeferredVerificationOfManyProofs)
+{
+    using IPA = IPA<Curve>;
+    // Proofs of different degrees, so the batched MSM covers a prefix of the SRS for some of them
+    const std::vector<size_t> degrees = { 128, 64, 128 };
+    std::vector<FoldedGeneratorClaim<Curve>> claims;
+    for (const size_t n : degrees) {
+        auto poly = this->random_polynomial(n);
+        auto [x, eval] = this->random_eval(poly);
+        const OpeningPair<Curve> opening_pair = { x, eval };
+        const OpeningClaim<Curve> opening_claim{ opening_pair, this->commit(poly) };
+
+        ProverTranscript<Fr> prover_transcript;
+        IPA::compute_opening_proof(this->ck(), opening_pair, poly, prover_transcript);
+
+        VerifierTranscript<Fr> verifier_transcript{ prover_transcript.proof_data };
+        auto claim = IPA::reduce_verification(this->vk(), opening_claim, verifier_transcript);
+        ASSERT_TRUE(claim.has_value());
+        claims.push_back(*claim);
+    }
+    EXPECT_TRUE(IPA::verify_folded_generator_claims(this->vk(), claims));
+
+    // A false claim fails the whole batch
+    claims[1].G_zero = GroupElement(claims[1].G_zero) + GroupElement::one();
+    EXPECT_FALSE(IPA::verify_folded_generator_claims(this->vk(), claims));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -49,6 +49,19 @@ TYPED_TEST(KZGTest, single)
     EXPECT_EQ(verified, true);
 }
 
+TYPED_TEST(KZGTest, FixedBaseCommit)
+{
+    const size_t n = 1024;
+
+    std::shared_ptr<barretenberg::srs::factories::CrsFactory<TypeParam>> crs_factory(
+        new barretenberg::srs::factories::FileCrsFactory<TypeParam>("../srs_db/ignition", n, true));
+    auto fixed_base_ck = std::make_shared<CommitmentKey<TypeParam>>(n, crs_factory);
+    EXPECT_NE(fixed_base_ck->srs->get_fixed_base_table(), nullptr);
+
+    auto witness = this->random_polynomial(n);
+    EXPECT_EQ(fixed_base_ck->commit(witness), this->commit(witness));
+}
+
 /**
  * @brief Test full PCS protocol: Gemini, Shplonk, KZG and pairing check
  * @details Demonstrates the full PCS protocol as it is used in the construction and verification
@@ -3,6 +3,7 @@
 #include "barretenberg/honk/transcript/transcript.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 #include <cstddef>
+#include <map>
 #include <memory>
 
 namespace proof_system::honk {
@@ -103,16 +104,35 @@ template <typename Curve> class work_queue {
 
     void process_queue()
     {
-        for (const auto& item : work_item_queue) {
-            switch (item.work_type) {
+        // All commitments are against the same SRS, so those of equal size are computed together in one batched MSM.
+        // The results are sent to the verifier in queue order.
+        std::map<size_t, std::vector<size_t>> msm_indices_by_size;
+        for (size_t i = 0; i < work_item_queue.size(); ++i) {
+            if (work_item_queue[i].work_type == WorkType::SCALAR_MULTIPLICATION) {
+                msm_indices_by_size[work_item_queue[i].mul_scalars.size()].push_back(i);
+            }
+        }
 
-            case WorkType::SCALAR_MULTIPLICATION: {
+        std::vector<Commitment> commitments(work_item_queue.size());
+        for (const auto& [msm_size, indices] : msm_indices_by_size) {
+            std::vector<std::span<FF>> polynomials;
+            for (const auto index : indices) {
+                polynomials.push_back(work_item_queue[index].mul_scalars);
+            }
 
-                // Run pippenger multi-scalar multiplication.
-                auto commitment = commitment_key->commit(item.mul_scalars);
+            // Run pippenger multi-scalar multiplication.
+            auto batch_commitments = commitment_key->batch_commit(polynomials);
+            for (size_t i = 0; i < indices.size(); ++i) {
+                commitments[indices[i]] = batch_commitments[i];
+            }
+        }
 
-                transcript.send_to_verifier(item.label, commitment);
+        for (size_t i = 0; i < work_item_queue.size(); ++i) {
+            const auto& item = work_item_queue[i];
+            switch (item.work_type) {
 
+            case WorkType::SCALAR_MULTIPLICATION: {
+                transcript.send_to_verifier(item.label, commitments[i]);
                 break;
             }
             default: {
@@ -151,6 +151,15 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataC
             result.value_at(k) = f.value_at(k);
         }
 
+        // Edges are linear, so each further value is just the previous one plus Δ (see the NOTE above).
+        if constexpr (domain_size == 2) {
+            const Fr delta = f.value_at(1) - f.value_at(0);
+            for (size_t k = domain_size; k != num_evals; ++k) {
+                result.value_at(k) = result.value_at(k - 1) + delta;
+            }
+            return result;
+        }
+
         for (size_t k = domain_size; k != num_evals; ++k) {
             result.value_at(k) = 0;
             // compute each term v_j / (d_j*(x-x_j)) of the sum
@@ -328,6 +337,15 @@ template <class Fr, size_t domain_size, size_t num_evals> class BarycentricDataR
             result.value_at(k) = f.value_at(k);
         }
 
+        // Edges are linear, so each further value is just the previous one plus Δ (see the NOTE above).
+        if constexpr (domain_size == 2) {
+            const Fr delta = f.value_at(1) - f.value_at(0);
+            for (size_t k = domain_size; k != num_evals; ++k) {
+                result.value_at(k) = result.value_at(k - 1) + delta;
+            }
+            return result;
+        }
+
         for (size_t k = domain_size; k != num_evals; ++k) {
             result.value_at(k) = 0;
             // compute each term v_j / (d_j*(x-x_j)) of the sum
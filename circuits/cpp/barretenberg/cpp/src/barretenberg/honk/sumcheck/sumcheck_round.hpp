@@ -132,14 +132,6 @@ template <typename Flavor> class SumcheckProverRound {
                                                                   const PowUnivariate<FF>& pow_univariate,
                                                                   const FF alpha)
     {
-        // Precompute the vector of required powers of zeta
-        // TODO(luke): Parallelize this
-        std::vector<FF> pow_challenges(round_size >> 1);
-        pow_challenges[0] = pow_univariate.partial_evaluation_constant;
-        for (size_t i = 1; i < (round_size >> 1); ++i) {
-            pow_challenges[i] = pow_challenges[i - 1] * pow_univariate.zeta_pow_sqr;
-        }
-
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
@@ -168,12 +160,13 @@ template <typename Flavor> class SumcheckProverRound {
 
             // For each edge_idx = 2i, we need to multiply the whole contribution by zeta^{2^{2i}}
             // This means that each univariate for each relation needs an extra multiplication.
+            // Each thread computes the power for its first edge directly, then steps through the rest, so the powers
+            // are generated in parallel without a precomputed table.
+            FF pow_challenge =
+                pow_univariate.partial_evaluation_constant * pow_univariate.zeta_pow_sqr.pow(start >> 1);
             for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
                 extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
 
-                // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
-                FF pow_challenge = pow_challenges[edge_idx >> 1];
-
                 // Compute the i-th edge's univariate contribution,
                 // scale it by the pow polynomial's constant and zeta power "c_l ⋅ ζ_{l+1}ⁱ"
                 // and add it to the accumulators for Sˡ(Xₗ)
@@ -181,13 +174,21 @@ template <typename Flavor> class SumcheckProverRound {
                                                   extended_edges[thread_idx],
                                                   relation_parameters,
                                                   pow_challenge);
+
+                // Update the pow polynomial's contribution c_l ⋅ ζ_{l+1}ⁱ for the next edge.
+                pow_challenge *= pow_univariate.zeta_pow_sqr;
             }
         });
 
-        // Accumulate the per-thread univariate accumulators into a single set of accumulators
-        for (auto& accumulators : thread_univariate_accumulators) {
-            add_nested_tuples(univariate_accumulators, accumulators);
+        // Sum the per-thread accumulators pairwise, so the reduction takes log(num_threads) parallel steps. The number
+        // of threads is a power of 2, so the sum ends up in the first accumulator.
+        for (size_t stride = 1; stride < num_threads; stride *= 2) {
+            parallel_for(num_threads / (2 * stride), [&](size_t i) {
+                add_nested_tuples(thread_univariate_accumulators[2 * stride * i],
+                                  thread_univariate_accumulators[2 * stride * i + stride]);
+            });
         }
+        add_nested_tuples(univariate_accumulators, thread_univariate_accumulators[0]);
         // Batch the univariate contributions from each sub-relation to obtain the round univariate
         return batch_over_relations(alpha, pow_univariate);
     }
@@ -18,6 +18,8 @@ namespace proof_system::plonk {
 void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_proving_key,
                                                std::vector<SelectorProperties> selector_properties)
 {
+    std::vector<barretenberg::polynomial> selector_polys;
+    std::vector<barretenberg::polynomial> selector_poly_ffts;
     for (size_t i = 0; i < selector_properties.size(); i++) {
         // Compute monomial form of selector polynomial
         auto selector_poly_lagrange =
@@ -26,14 +28,23 @@ void compute_monomial_and_coset_selector_forms(plonk::proving_key* circuit_provi
         barretenberg::polynomial_arithmetic::ifft(
             &selector_poly_lagrange[0], &selector_poly[0], circuit_proving_key->small_domain);
 
-        // Compute coset FFT of selector polynomial
-        barretenberg::polynomial selector_poly_fft(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
-        selector_poly_fft.coset_fft(circuit_proving_key->large_domain);
+        selector_poly_ffts.emplace_back(selector_poly, circuit_proving_key->circuit_size * 4 + 4);
+        selector_polys.emplace_back(std::move(selector_poly));
+    }
+
+    // Compute coset FFTs of the selector polynomials, all in one batch
+    std::vector<barretenberg::fr*> selector_fft_coefficients;
+    for (auto& selector_poly_fft : selector_poly_ffts) {
+        selector_fft_coefficients.push_back(selector_poly_fft.data().get());
+    }
+    barretenberg::polynomial_arithmetic::batch_coset_fft(selector_fft_coefficients, circuit_proving_key->large_domain);
 
+    for (size_t i = 0; i < selector_properties.size(); i++) {
         // TODO(luke): For Standard/Turbo, the lagrange polynomials can be removed from the store at this point but this
         // is not the case for Ultra. Implement?
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_poly));
-        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft", std::move(selector_poly_fft));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name, std::move(selector_polys[i]));
+        circuit_proving_key->polynomial_store.put(selector_properties[i].name + "_fft",
+                                                  std::move(selector_poly_ffts[i]));
     }
 }
 
@@ -498,12 +498,12 @@ std::shared_ptr<plonk::verification_key> UltraComposer::compute_verification_key
 
     circuit_verification_key->circuit_type = CircuitType::ULTRA;
 
-    // See `add_recusrive_proof()` for how this recursive data is assigned.
+    // See `add_recusrive_proof()` for how this recursive data is assigned. It is taken from the proving key, which may
+    // have been loaded rather than computed from `circuit_constructor`.
     circuit_verification_key->recursive_proof_public_input_indices =
-        std::vector<uint32_t>(circuit_constructor.recursive_proof_public_input_indices.begin(),
-                              circuit_constructor.recursive_proof_public_input_indices.end());
+        circuit_proving_key->recursive_proof_public_input_indices;
 
-    circuit_verification_key->contains_recursive_proof = circuit_constructor.contains_recursive_proof;
+    circuit_verification_key->contains_recursive_proof = circuit_proving_key->contains_recursive_proof;
 
     return circuit_verification_key;
 }
@@ -850,4 +850,72 @@ TEST(ultra_plonk_composer, range_constraint_small_variable)
     EXPECT_EQ(result, true);
 }
 
+// Proofs of circuits with the same shape share a verification key, and can be checked together with one pairing.
+TEST(ultra_plonk_composer, batch_verify)
+{
+    constexpr size_t num_proofs = 4;
+    std::vector<plonk::proof> proofs;
+    std::optional<UltraVerifier> verifier;
+    for (size_t i = 0; i < num_proofs; ++i) {
+        auto builder = UltraCircuitBuilder();
+        auto composer = UltraComposer();
+        const fr a = fr::random_element();
+        const fr b = fr::random_element();
+        const auto a_idx = builder.add_variable(a);
+        const auto b_idx = builder.add_variable(b);
+        const auto c_idx = builder.add_public_variable(a * b);
+        builder.create_mul_gate({ a_idx, b_idx, c_idx, 1, -1, 0 });
+        builder.create_range_constraint(a_idx, 254, "bad range");
+
+        auto prover = composer.create_prover(builder);
+        proofs.emplace_back(prover.construct_proof());
+        if (!verifier) {
+            verifier.emplace(composer.create_verifier(builder));
+        }
+    }
+    EXPECT_EQ(verifier->batch_verify(proofs), std::nullopt);
+
+    // Change the public input of one proof; the batch is rejected, and that proof is the one reported
+    proofs[2].proof_data[31] ^= 1;
+    EXPECT_EQ(verifier->batch_verify(proofs), std::optional<size_t>(2));
+    EXPECT_FALSE(verifier->verify_proof(proofs[2]));
+    EXPECT_TRUE(verifier->verify_proof(proofs[3]));
+}
+
+#ifndef __wasm__
+// Freeing and spilling the witness polynomials as the prover goes leaves the proof valid, and the key with all of its
+// selector and permutation polynomials but only the monomial forms of the witness.
+TEST(ultra_plonk_composer, release_witness_polynomials)
+{
+    auto builder = UltraCircuitBuilder();
+    auto composer = UltraComposer();
+
+    const fr input = 1234;
+    const auto input_index = builder.add_variable(input);
+    const auto accumulators = plookup::get_lookup_accumulators(MultiTableId::PEDERSEN_LEFT_LO, input);
+    builder.create_gates_from_plookup_accumulators(MultiTableId::PEDERSEN_LEFT_LO, accumulators, input_index);
+    builder.create_range_constraint(input_index, 16, "bad range");
+
+    auto prover = composer.create_prover(builder);
+    prover.release_witness_polynomials = true;
+    auto proof = prover.construct_proof();
+    auto verifier = composer.create_verifier(builder);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+
+    auto& store = prover.key->polynomial_store;
+    PrecomputedPolyList precomputed_poly_list(prover.key->circuit_type);
+    for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
+        EXPECT_TRUE(store.contains(precomputed_poly_list[i]));
+    }
+    for (std::string label : { "w_1", "w_4", "z_perm", "s", "z_lookup" }) {
+        EXPECT_TRUE(store.contains(label));
+        EXPECT_FALSE(store.is_spilled(label));
+        EXPECT_FALSE(store.contains(label + "_lagrange"));
+        EXPECT_FALSE(store.contains(label + "_fft"));
+    }
+    EXPECT_FALSE(store.contains("s_1_lagrange"));
+    EXPECT_FALSE(store.contains("lagrange_1_fft"));
+}
+#endif
+
 } // namespace proof_system::plonk::test_ultra_plonk_composer
@@ -0,0 +1,66 @@
+#include "polynomial_lifetimes.hpp"
+#include <algorithm>
+
+namespace proof_system::plonk {
+
+#ifndef __wasm__
+PolynomialLifetimes::PolynomialLifetimes(PolynomialManifest const& manifest)
+{
+    for (size_t i = 0; i < manifest.size(); ++i) {
+        auto label = std::string(manifest[i].polynomial_label);
+        if (manifest[i].source == PolynomialSource::WITNESS) {
+            witness_labels.emplace_back(label);
+        } else if (manifest[i].source != PolynomialSource::OTHER) {
+            precomputed_labels.emplace_back(label);
+        }
+    }
+}
+
+/**
+ * @brief Free every form with the given suffix of a polynomial that is not a selector or permutation polynomial. This
+ * covers the forms of the manifest's witness polynomials, and the intermediates computed from them that are not in the
+ * manifest (the sorted lookup columns s_1..s_4 and L_1).
+ */
+void PolynomialLifetimes::free_forms(std::string const& suffix, PolynomialStore<barretenberg::fr>& store) const
+{
+    std::vector<std::string> labels;
+    for (auto const& [label, _] : store) {
+        if (!label.ends_with(suffix)) {
+            continue;
+        }
+        auto base = label.substr(0, label.size() - suffix.size());
+        if (std::find(precomputed_labels.begin(), precomputed_labels.end(), base) == precomputed_labels.end()) {
+            labels.emplace_back(label);
+        }
+    }
+    for (auto const& label : labels) {
+        store.remove(label);
+    }
+}
+
+void PolynomialLifetimes::end_round(size_t round, PolynomialStore<barretenberg::fr>& store) const
+{
+    switch (round) {
+    case 3:
+        free_forms("_lagrange", store);
+        for (auto const& label : witness_labels) {
+            if (store.contains(label)) {
+                store.spill(label);
+            }
+        }
+        break;
+    case 4:
+        free_forms("_fft", store);
+        for (auto const& label : witness_labels) {
+            if (store.is_spilled(label)) {
+                store.restore(label);
+            }
+        }
+        break;
+    default:
+        break;
+    }
+}
+#endif
+
+} // namespace proof_system::plonk
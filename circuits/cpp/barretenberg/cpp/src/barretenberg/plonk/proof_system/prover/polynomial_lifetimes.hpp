@@ -0,0 +1,40 @@
+#pragma once
+#include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
+#include <string>
+#include <vector>
+
+namespace proof_system::plonk {
+
+#ifndef __wasm__
+/**
+ * @brief Frees, or spills to disk, the witness polynomials in a proving key's store once the prover has no more use
+ * for them, to cut the peak memory of a proof.
+ *
+ * The rounds of ProverBase read the three forms of a witness polynomial at different times: the Lagrange forms up to
+ * the third round (the wire commitments and the permutation and lookup grand products), the coset FFT forms only in
+ * the fourth (the quotient), and the monomial forms in the third and then again in the fifth and sixth (evaluations
+ * and opening proofs). So after the third round the Lagrange forms are freed and the monomial forms spilled, leaving
+ * the quotient computation, where memory peaks, with just what it reads. After the fourth round the FFT forms are
+ * freed and the monomial forms read back.
+ *
+ * Selector and permutation polynomials are never touched: they belong to the key, which may go on to make more proofs.
+ */
+class PolynomialLifetimes {
+  public:
+    PolynomialLifetimes(PolynomialManifest const& manifest);
+
+    /**
+     * @brief Frees and spills the polynomials that are done with once the given round (numbered as in
+     * ProverBase::construct_proof, with the preamble round 0) and its queued work have completed.
+     */
+    void end_round(size_t round, PolynomialStore<barretenberg::fr>& store) const;
+
+  private:
+    void free_forms(std::string const& suffix, PolynomialStore<barretenberg::fr>& store) const;
+
+    std::vector<std::string> witness_labels;
+    std::vector<std::string> precomputed_labels;
+};
+#endif
+
+} // namespace proof_system::plonk
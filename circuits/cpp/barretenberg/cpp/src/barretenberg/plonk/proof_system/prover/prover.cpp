@@ -35,6 +35,7 @@ ProverBase<settings>::ProverBase(ProverBase<settings>&& other)
     , key(std::move(other.key))
     , commitment_scheme(std::move(other.commitment_scheme))
     , queue(key.get(), &transcript)
+    , release_witness_polynomials(other.release_witness_polynomials)
 {
     for (size_t i = 0; i < other.random_widgets.size(); ++i) {
         random_widgets.emplace_back(std::move(other.random_widgets[i]));
@@ -61,6 +62,7 @@ template <typename settings> ProverBase<settings>& ProverBase<settings>::operato
     commitment_scheme = std::move(other.commitment_scheme);
 
     queue = work_queue(key.get(), &transcript);
+    release_witness_polynomials = other.release_witness_polynomials;
     return *this;
 }
 
@@ -498,40 +500,61 @@ template <typename settings> plonk::proof& ProverBase<settings>::construct_proof
     // info("preamble");
     execute_preamble_round();
     queue.process_queue();
+    release_polynomials(0);
 
     // Compute wire precommitments and sometimes random widget round commitments
     // info("first");
     execute_first_round();
     queue.process_queue();
+    release_polynomials(1);
 
     // Fiat-Shamir eta + execute random widgets.
     // info("second");
     execute_second_round();
     queue.process_queue();
+    release_polynomials(2);
 
     // Fiat-Shamir beta & gamma, execute random widgets (Permutation widget is executed here)
     // and fft the witnesses
     // info("third");
     execute_third_round();
     queue.process_queue();
+    release_polynomials(3);
 
     // Fiat-Shamir alpha, compute & commit to quotient polynomial.
     // info("fourth");
     execute_fourth_round();
     queue.process_queue();
+    release_polynomials(4);
 
     // info("fifth");
     execute_fifth_round();
+    release_polynomials(5);
 
     // info("sixth");
     execute_sixth_round();
     queue.process_queue();
+    release_polynomials(6);
 
     queue.flush_queue();
 
     return export_proof();
 }
 
+/**
+ * @brief Free or spill the witness polynomials that the given round was the last to read, if enabled.
+ */
+template <typename settings> void ProverBase<settings>::release_polynomials(const size_t round)
+{
+#ifndef __wasm__
+    if (release_witness_polynomials) {
+        PolynomialLifetimes(key->polynomial_manifest).end_round(round, key->polynomial_store);
+    }
+#else
+    static_cast<void>(round);
+#endif
+}
+
 template <typename settings> void ProverBase<settings>::reset()
 {
     transcript::Manifest manifest = transcript.get_manifest();
@@ -5,6 +5,7 @@
 #include "../types/proof.hpp"
 #include "../widgets/random_widgets/random_widget.hpp"
 #include "../widgets/transition_widgets/transition_widget.hpp"
+#include "./polynomial_lifetimes.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 
 namespace proof_system::plonk {
@@ -95,7 +96,14 @@ template <typename settings> class ProverBase {
 
     work_queue queue;
 
+    // Free or spill the witness polynomials in the key as soon as the prover is done with them, to cut peak memory
+    // (see PolynomialLifetimes). Leaves the key without the witness it was given, so only set it when the key's
+    // witness is recomputed for every proof. Has no effect in wasm.
+    bool release_witness_polynomials = false;
+
   private:
+    void release_polynomials(const size_t round);
+
     plonk::proof proof;
 };
 extern template class ProverBase<standard_settings>;
@@ -89,50 +89,23 @@ TEST(proving_key, proving_key_from_serialized_key_ultra)
     EXPECT_EQ(p_key.contains_recursive_proof, proving_key->contains_recursive_proof);
 }
 
-/**
-// Test that a proving key can be serialized/deserialized using mmap
+// Test that a proving key can be written in the memory mapped format, and read back
 #ifndef __wasm__
 TEST(proving_key, proving_key_from_mmaped_key)
 {
-        builder coStandardCircuitBuilder = StandardComposer();auto composer =
-StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
-
-    // Write each precomputed polynomial in the proving key to
-    // its own file using write_mmap
-    std::string pk_dir = "../src/barretenberg/proof_system/proving_key/fixtures";
-    std::filesystem::create_directories(pk_dir);
-    std::string pk_path = pk_dir + "/proving_key";
-    std::ofstream os(pk_path);
-    // TODO: Investigate why this test fails in CI.
-    // WASI-SDK does not include support for <filesystem>, so we had to replace the call to
-    // `std::filesystem::create_directories(pk_dir);`
-    // with
-    // `mkdir(pk_dir.c_str(), 0700);`.
-    // It looks like the POSIX method would set the ERRNO after attempting to create the directory.
-    // The exception block is left here to help solve the problem later.
-    // try {
-    //     os.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    // } catch (const std::ios_base::failure& e) {
-    //     std::cout << "Caught an ios_base::failure.\n"
-    //               << "Error code: " << e.code().value() << " (" << e.code().message() << ")\n"
-    //               << "Error category: " << e.code().category().name() << '\n';
-    // }
-    if (!os.good()) {
-        std::cerr << "OS failed in composer_from_mmap_keys! \n";
-    }
+    auto builder = UltraCircuitBuilder();
+    auto composer = UltraComposer();
+    fr a = fr::one();
+    builder.add_public_variable(a);
+
+    std::string pk_path = (std::filesystem::temp_directory_path() / "bb_proving_key_mmap").string();
     plonk::proving_key& p_key = *composer.compute_proving_key(builder);
-    write_mmap(os, pk_dir, p_key);
-    os.close();
-
-    // Read each precomputed polynomial from the files written above
-    // into a proving_key_data polynomial store using read_mmap
-    std::ifstream pk_stream = std::ifstream(pk_path);
-    if (!pk_stream.good()) {
-        std::cerr << "IS failed in composer_from_mmap_keys! \n";
-    }
+    write_mmap(pk_path, p_key);
+
     plonk::proving_key_data pk_data;
-    read_mmap(pk_stream, pk_dir, pk_data);
-    pk_stream.close();
+    read_mmap(pk_path, pk_data);
+    // The mapping stays valid for as long as the polynomials viewing it.
+    std::filesystem::remove(pk_path);
 
     // Loop over all pre-computed polys for the given composer type and ensure equality
     // between original proving key polynomial store and the polynomial store that was
@@ -141,19 +114,51 @@ StandardComposer(); fr a = fr::one(); builder.add_public_variable(a);
     bool all_polys_are_equal{ true };
     for (size_t i = 0; i < precomputed_poly_list.size(); ++i) {
         std::string poly_id = precomputed_poly_list[i];
-        barretenberg::polynomial& input_poly = p_key.polynomial_store.get(poly_id);
-        barretenberg::polynomial& output_poly = pk_data.polynomial_store.get(poly_id);
+        auto input_poly = p_key.polynomial_store.get(poly_id);
+        auto output_poly = pk_data.polynomial_store.get(poly_id);
         all_polys_are_equal = all_polys_are_equal && (input_poly == output_poly);
+        EXPECT_EQ((uintptr_t)output_poly.data().get() % MMAP_ALIGNMENT, 0UL);
+        EXPECT_TRUE(output_poly[output_poly.size()].is_zero());
     }
 
     // Check that all pre-computed polynomials are equal
     EXPECT_EQ(all_polys_are_equal, true);
 
     // Check equality of other proving_key_data data
-    EXPECT_EQ(p_key.circuit_type, pk_data.circuit_type);
+    EXPECT_EQ(static_cast<uint32_t>(p_key.circuit_type), pk_data.circuit_type);
     EXPECT_EQ(p_key.circuit_size, pk_data.circuit_size);
     EXPECT_EQ(p_key.num_public_inputs, pk_data.num_public_inputs);
     EXPECT_EQ(p_key.contains_recursive_proof, pk_data.contains_recursive_proof);
+    EXPECT_EQ(p_key.memory_read_records, pk_data.memory_read_records);
+    EXPECT_EQ(p_key.memory_write_records, pk_data.memory_write_records);
+
+    // A proof made with the mapped key verifies.
+    auto crs = std::make_shared<barretenberg::srs::factories::FileCrsFactory<curve::BN254>>("../srs_db/ignition");
+    auto proving_key =
+        std::make_shared<plonk::proving_key>(std::move(pk_data), crs->get_prover_crs(p_key.circuit_size + 1));
+    auto prove_builder = UltraCircuitBuilder();
+    prove_builder.add_public_variable(a);
+    auto prove_composer = UltraComposer(proving_key, nullptr);
+    prove_composer.crs_factory_ = crs;
+    auto prover = prove_composer.create_prover(prove_builder);
+    auto proof = prover.construct_proof();
+    auto verifier = prove_composer.create_verifier(prove_builder);
+    EXPECT_TRUE(verifier.verify_proof(proof));
+}
+
+// A file that is not a complete mapped proving key is rejected, rather than read past its end.
+TEST(proving_key, truncated_mmaped_key_is_rejected)
+{
+    auto builder = StandardCircuitBuilder();
+    auto composer = StandardComposer();
+    builder.add_public_variable(fr::one());
+
+    std::string pk_path = (std::filesystem::temp_directory_path() / "bb_proving_key_mmap_truncated").string();
+    write_mmap(pk_path, *composer.compute_proving_key(builder));
+    std::filesystem::resize_file(pk_path, std::filesystem::file_size(pk_path) - 1);
+
+    plonk::proving_key_data pk_data;
+    EXPECT_ANY_THROW(read_mmap(pk_path, pk_data));
+    std::filesystem::remove(pk_path);
 }
 #endif
-*/
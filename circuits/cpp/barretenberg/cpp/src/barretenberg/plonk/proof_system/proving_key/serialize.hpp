@@ -5,8 +5,13 @@
 #include "barretenberg/polynomials/serialize.hpp"
 #include "proving_key.hpp"
 #include <fcntl.h>
+#include <cstring>
 #include <ios>
 #include <sys/stat.h>
+#ifndef __wasm__
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace proof_system::plonk {
 
@@ -138,4 +143,158 @@ template <typename B> inline void write_to_file(B& os, std::string const& path,
     write(os, key.memory_write_records);
 }
 
+
+#ifndef __wasm__
+/**
+ * A proving key format that is memory mapped rather than parsed. Reading one copies nothing: the precomputed
+ * polynomials (including the coset FFT forms) are views of the mapped file, so their pages are only read from disk when
+ * the prover first touches them, and processes proving the same circuit share them through the page cache.
+ *
+ * The layout, in native byte order:
+ * - an MmapHeader
+ * - a table of contents, with an MmapTocEntry per polynomial
+ * - the remaining proving key fields, serialized as in write()
+ * - each polynomial's coefficients in Montgomery form, starting on an MMAP_ALIGNMENT boundary and followed by one zero
+ *   coefficient, as a polynomial's capacity is one more than its size
+ */
+constexpr uint64_t MMAP_MAGIC = 0x50414d4d4b504242; // "BBPKMMAP"
+// Bump whenever the layout changes.
+constexpr uint32_t MMAP_VERSION = 1;
+constexpr size_t MMAP_ALIGNMENT = 64;
+
+struct MmapHeader {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t field_size;
+    uint32_t circuit_type;
+    uint32_t circuit_size;
+    uint32_t num_public_inputs;
+    uint32_t num_polynomials;
+    uint64_t records_offset;
+    uint64_t records_size;
+    uint64_t file_size;
+};
+
+struct MmapTocEntry {
+    char label[48];
+    uint64_t offset;
+    uint64_t size;
+};
+
+inline void write_mmap(std::string const& path, proving_key& key)
+{
+    using serialize::write;
+    auto align = [](size_t offset) { return (offset + MMAP_ALIGNMENT - 1) & ~(MMAP_ALIGNMENT - 1); };
+
+    std::vector<uint8_t> records;
+    write(records, key.contains_recursive_proof);
+    write(records, key.recursive_proof_public_input_indices);
+    write(records, key.memory_read_records);
+    write(records, key.memory_write_records);
+
+    PrecomputedPolyList precomputed_poly_list(key.circuit_type);
+    const size_t num_polys = precomputed_poly_list.size();
+    std::vector<barretenberg::polynomial> polys;
+    std::vector<MmapTocEntry> toc(num_polys);
+    const size_t records_offset = sizeof(MmapHeader) + num_polys * sizeof(MmapTocEntry);
+    size_t offset = align(records_offset + records.size());
+    for (size_t i = 0; i < num_polys; ++i) {
+        std::string poly_id = precomputed_poly_list[i];
+        if (poly_id.size() >= sizeof(MmapTocEntry::label)) {
+            throw_or_abort("Polynomial label too long: " + poly_id);
+        }
+        polys.push_back(key.polynomial_store.get(poly_id));
+        std::memset(toc[i].label, 0, sizeof(toc[i].label));
+        std::memcpy(toc[i].label, poly_id.data(), poly_id.size());
+        toc[i].offset = offset;
+        toc[i].size = polys[i].size();
+        offset = align(offset + (polys[i].size() + 1) * sizeof(barretenberg::fr));
+    }
+
+    MmapHeader header{ .magic = MMAP_MAGIC,
+                       .version = MMAP_VERSION,
+                       .field_size = sizeof(barretenberg::fr),
+                       .circuit_type = static_cast<uint32_t>(key.circuit_type),
+                       .circuit_size = static_cast<uint32_t>(key.circuit_size),
+                       .num_public_inputs = static_cast<uint32_t>(key.num_public_inputs),
+                       .num_polynomials = static_cast<uint32_t>(num_polys),
+                       .records_offset = records_offset,
+                       .records_size = records.size(),
+                       .file_size = offset };
+
+    std::ofstream os(path, std::ios::binary | std::ios::trunc);
+    os.write((char const*)&header, sizeof(header));
+    os.write((char const*)toc.data(), (std::streamsize)(num_polys * sizeof(MmapTocEntry)));
+    os.write((char const*)records.data(), (std::streamsize)records.size());
+    const std::vector<char> padding(MMAP_ALIGNMENT, 0);
+    const barretenberg::fr zero = 0;
+    size_t position = records_offset + records.size();
+    for (size_t i = 0; i < num_polys; ++i) {
+        os.write(padding.data(), (std::streamsize)(toc[i].offset - position));
+        os.write((char const*)polys[i].data().get(), (std::streamsize)(polys[i].size() * sizeof(barretenberg::fr)));
+        os.write((char const*)&zero, sizeof(zero));
+        position = toc[i].offset + (polys[i].size() + 1) * sizeof(barretenberg::fr);
+    }
+    os.write(padding.data(), (std::streamsize)(header.file_size - position));
+    if (!os.good()) {
+        throw_or_abort("Failed to write: " + path);
+    }
+}
+
+inline void read_mmap(std::string const& path, proving_key_data& key)
+{
+    using serialize::read;
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw_or_abort("Failed to open file: " + path);
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(MmapHeader)) {
+        close(fd);
+        throw_or_abort("Not a proving key: " + path);
+    }
+    const auto file_size = (size_t)st.st_size;
+    // Privately mapped: a prover writing to a polynomial gets its own copy of the page, and the file is untouched.
+    void* memory = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (memory == MAP_FAILED) {
+        throw_or_abort("Failed to map file: " + path);
+    }
+    std::shared_ptr<uint8_t[]> mapping((uint8_t*)memory, [file_size](uint8_t* p) { munmap(p, file_size); });
+
+    MmapHeader header;
+    std::memcpy(&header, mapping.get(), sizeof(header));
+    const size_t toc_end = sizeof(MmapHeader) + header.num_polynomials * sizeof(MmapTocEntry);
+    if (header.magic != MMAP_MAGIC || header.version != MMAP_VERSION || header.field_size != sizeof(barretenberg::fr) ||
+        header.file_size != file_size || toc_end > file_size || header.records_offset < toc_end ||
+        header.records_offset + header.records_size > file_size) {
+        throw_or_abort("Not a proving key, or from another version: " + path);
+    }
+
+    key.circuit_type = header.circuit_type;
+    key.circuit_size = header.circuit_size;
+    key.num_public_inputs = header.num_public_inputs;
+
+    for (size_t i = 0; i < header.num_polynomials; ++i) {
+        MmapTocEntry entry;
+        std::memcpy(&entry, mapping.get() + sizeof(MmapHeader) + i * sizeof(MmapTocEntry), sizeof(entry));
+        if (entry.label[sizeof(entry.label) - 1] != 0 || entry.offset % MMAP_ALIGNMENT != 0 ||
+            entry.offset + (entry.size + 1) * sizeof(barretenberg::fr) > file_size) {
+            throw_or_abort("Corrupt proving key: " + path);
+        }
+        // Shares ownership of the mapping, which is unmapped once the last polynomial viewing it is gone.
+        auto coefficients =
+            std::shared_ptr<barretenberg::fr[]>(mapping, (barretenberg::fr*)(mapping.get() + entry.offset));
+        key.polynomial_store.put(entry.label, barretenberg::polynomial(std::move(coefficients), entry.size));
+    }
+
+    auto it = (uint8_t const*)mapping.get() + header.records_offset;
+    read(it, key.contains_recursive_proof);
+    read(it, key.recursive_proof_public_input_indices);
+    read(it, key.memory_read_records);
+    read(it, key.memory_write_records);
+}
+#endif
+
 } // namespace proof_system::plonk
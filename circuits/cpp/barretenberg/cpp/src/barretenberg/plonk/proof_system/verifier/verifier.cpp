@@ -11,6 +11,40 @@
 using namespace barretenberg;
 
 namespace proof_system::plonk {
+namespace {
+/**
+ * @brief Computes sum_i scalars_i.elements_i. Takes its inputs by value, as pippenger works on them in place.
+ */
+g1::element multi_scalar_multiplication(std::vector<fr> scalars, std::vector<g1::affine_element> elements)
+{
+    const size_t num_elements = elements.size();
+    elements.resize(num_elements * 2);
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+        elements.data(), elements.data(), num_elements);
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
+    return barretenberg::scalar_multiplication::pippenger<curve::BN254>(
+        scalars.data(), elements.data(), num_elements, state);
+}
+
+/**
+ * @brief The final pairing check of step 12: e(P_0, [x]_2).e(P_1, [1]_2) == 1.
+ */
+bool pairing_check(const g1::element& P_0, const g1::element& P_1, const std::shared_ptr<verification_key>& key)
+{
+    g1::element P[2]{ P_0, P_1 };
+    g1::element::batch_normalize(P, 2);
+
+    g1::affine_element P_affine[2]{
+        { P[0].x, P[0].y },
+        { P[1].x, P[1].y },
+    };
+
+    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
+        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+
+    return (result == barretenberg::fq12::one());
+}
+} // namespace
 template <typename program_settings>
 VerifierBase<program_settings>::VerifierBase(std::shared_ptr<verification_key> verifier_key,
                                              const transcript::Manifest& input_manifest)
@@ -36,7 +70,9 @@ VerifierBase<program_settings>& VerifierBase<program_settings>::operator=(Verifi
     return *this;
 }
 
-template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+template <typename program_settings>
+typename VerifierBase<program_settings>::PairingClaim VerifierBase<program_settings>::compute_pairing_claim(
+    const plonk::proof& proof)
 {
     // This function verifies a PLONK proof for given program settings.
     // A PLONK proof for standard PLONK is of the form:
@@ -48,6 +84,8 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     // Proof π_SNARK must first be added to the transcript with the other program_settings.
 
     key->program_width = program_settings::program_width;
+    kate_g1_elements.clear();
+    kate_fr_elements.clear();
 
     // Add the proof data to the transcript, according to the manifest. Also initialise the transcript's hash type and
     // challenge bytes.
@@ -163,27 +201,19 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
     kate_g1_elements.insert({ "PI_Z", PI_Z });
     kate_fr_elements.insert({ "PI_Z", zeta });
 
-    std::vector<fr> scalars;
-    std::vector<g1::affine_element> elements;
-
-    for (const auto& [key, value] : kate_g1_elements) {
+    PairingClaim claim;
+    for (const auto& [label, value] : kate_g1_elements) {
         // TODO: perhaps we should throw if not on curve or if infinity?
         if (value.on_curve() && !value.is_point_at_infinity()) {
-            scalars.emplace_back(kate_fr_elements.at(key));
-            elements.emplace_back(value);
+            claim.labels.emplace_back(label);
+            claim.scalars.emplace_back(kate_fr_elements.at(label));
+            claim.elements.emplace_back(value);
         }
     }
 
-    size_t num_elements = elements.size();
-    elements.resize(num_elements * 2);
-    barretenberg::scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
-        &elements[0], &elements[0], num_elements);
-    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(num_elements);
-
-    g1::element P[2];
-
-    P[0] = barretenberg::scalar_multiplication::pippenger<curve::BN254>(&scalars[0], &elements[0], num_elements, state);
-    P[1] = -(g1::element(PI_Z_OMEGA) * separator_challenge + PI_Z);
+    // P_1 = -(separator.[W_zω]_1 + [W_z]_1)
+    claim.p1_scalars = { -separator_challenge, -fr::one() };
+    claim.p1_elements = { PI_Z_OMEGA, PI_Z };
 
     if (key->contains_recursive_proof) {
         ASSERT(key->recursive_proof_public_input_indices.size() == 16);
@@ -220,22 +250,101 @@ template <typename program_settings> bool VerifierBase<program_settings>::verify
                                                       key->recursive_proof_public_input_indices[14],
                                                       key->recursive_proof_public_input_indices[15]);
 
-        P[0] += g1::element(x0, y0, 1) * recursion_separator_challenge;
-        P[1] += g1::element(x1, y1, 1) * recursion_separator_challenge;
+        // The pairing points output by the recursive verifier are accumulated into P_0 and P_1
+        const g1::affine_element recursion_P_0(x0, y0);
+        const g1::affine_element recursion_P_1(x1, y1);
+        if (!recursion_P_0.on_curve() || recursion_P_0.is_point_at_infinity() || !recursion_P_1.on_curve() ||
+            recursion_P_1.is_point_at_infinity()) {
+            claim.well_formed = false;
+            return claim;
+        }
+        claim.labels.emplace_back("RECURSION_P_0");
+        claim.scalars.emplace_back(recursion_separator_challenge);
+        claim.elements.emplace_back(recursion_P_0);
+        claim.p1_scalars.emplace_back(recursion_separator_challenge);
+        claim.p1_elements.emplace_back(recursion_P_1);
     }
 
-    g1::element::batch_normalize(P, 2);
+    return claim;
+}
 
-    g1::affine_element P_affine[2]{
-        { P[0].x, P[0].y },
-        { P[1].x, P[1].y },
-    };
+template <typename program_settings> bool VerifierBase<program_settings>::verify_proof(const plonk::proof& proof)
+{
+    const PairingClaim claim = compute_pairing_claim(proof);
+    if (!claim.well_formed) {
+        return false;
+    }
+    return pairing_check(multi_scalar_multiplication(claim.scalars, claim.elements),
+                         multi_scalar_multiplication(claim.p1_scalars, claim.p1_elements),
+                         key);
+}
 
-    // The final pairing check of step 12.
-    barretenberg::fq12 result = barretenberg::pairing::reduced_ate_pairing_batch_precomputed(
-        P_affine, key->reference_string->get_precomputed_g2_lines(), 2);
+/**
+ * @brief Verifies proofs that share this verifier's key with one pairing.
+ *
+ * @details Each proof's transcript is processed as in verify_proof, down to its pairing claim. The claims are then
+ * folded with random weights: the folded claim holds iff all of them do, except with negligible probability. Terms
+ * of the key's commitments are shared by all claims, so the folded P_0 is one multi-scalar multiplication over the
+ * key's commitments once plus each proof's own commitments, and P_1 is one more over the opening proofs. Only when the
+ * folded claim fails are the claims checked one at a time, to find a proof that does not verify.
+ *
+ * @return std::nullopt if every proof verifies, otherwise the index of the first one that does not.
+ */
+template <typename program_settings>
+std::optional<size_t> VerifierBase<program_settings>::batch_verify(std::span<const plonk::proof> proofs)
+{
+    // The transcripts are processed one after the other: the verifier's key and kate maps are shared scratch space.
+    std::vector<PairingClaim> claims;
+    claims.reserve(proofs.size());
+    for (size_t i = 0; i < proofs.size(); ++i) {
+        claims.emplace_back(compute_pairing_claim(proofs[i]));
+        if (!claims.back().well_formed) {
+            return i;
+        }
+    }
 
-    return (result == barretenberg::fq12::one());
+    std::vector<fr> scalars;
+    std::vector<g1::affine_element> elements;
+    std::vector<fr> p1_scalars;
+    std::vector<g1::affine_element> p1_elements;
+    // Position in scalars and elements of each term common to all proofs
+    std::map<std::string, size_t> shared_terms;
+    for (size_t i = 0; i < claims.size(); ++i) {
+        const auto& claim = claims[i];
+        const fr weight = (i == 0) ? fr::one() : fr::random_element();
+        for (size_t j = 0; j < claim.elements.size(); ++j) {
+            const fr scalar = weight * claim.scalars[j];
+            if (key->commitments.contains(claim.labels[j])) {
+                const auto [shared_term, inserted] = shared_terms.try_emplace(claim.labels[j], elements.size());
+                if (!inserted) {
+                    scalars[shared_term->second] += scalar;
+                    continue;
+                }
+            }
+            scalars.emplace_back(scalar);
+            elements.emplace_back(claim.elements[j]);
+        }
+        for (size_t j = 0; j < claim.p1_elements.size(); ++j) {
+            p1_scalars.emplace_back(weight * claim.p1_scalars[j]);
+            p1_elements.emplace_back(claim.p1_elements[j]);
+        }
+    }
+
+    if (pairing_check(multi_scalar_multiplication(std::move(scalars), std::move(elements)),
+                      multi_scalar_multiplication(std::move(p1_scalars), std::move(p1_elements)),
+                      key)) {
+        return std::nullopt;
+    }
+
+    for (size_t i = 0; i < claims.size(); ++i) {
+        if (!pairing_check(multi_scalar_multiplication(claims[i].scalars, claims[i].elements),
+                           multi_scalar_multiplication(claims[i].p1_scalars, claims[i].p1_elements),
+                           key)) {
+            return i;
+        }
+    }
+    // The folded claim failed although every claim holds, which happens with negligible probability
+    return std::nullopt;
 }
 
 template class VerifierBase<standard_verifier_settings>;
@@ -4,6 +4,8 @@
 #include "../widgets/random_widgets/random_widget.hpp"
 #include "barretenberg/plonk/proof_system/commitment_scheme/commitment_scheme.hpp"
 #include "barretenberg/transcript/manifest.hpp"
+#include <optional>
+#include <span>
 
 namespace proof_system::plonk {
 template <typename program_settings> class VerifierBase {
@@ -19,7 +21,24 @@ template <typename program_settings> class VerifierBase {
     bool validate_commitments();
     bool validate_scalars();
 
+    /**
+     * @brief The claim a proof reduces to once its transcript is processed: the proof is valid iff
+     * e(P_0, [x]_2).e(P_1, [1]_2) == 1, where P_0 and P_1 are the multi-scalar multiplications below.
+     */
+    struct PairingClaim {
+        // The label of each term of P_0. Terms labelled with a commitment of the key are shared by every proof for it.
+        std::vector<std::string> labels;
+        std::vector<barretenberg::fr> scalars;
+        std::vector<barretenberg::g1::affine_element> elements;
+        std::vector<barretenberg::fr> p1_scalars;
+        std::vector<barretenberg::g1::affine_element> p1_elements;
+        // False if the proof carries a recursion output that is not a point, so no pairing can accept it
+        bool well_formed = true;
+    };
+
+    PairingClaim compute_pairing_claim(const plonk::proof& proof);
     bool verify_proof(const plonk::proof& proof);
+    std::optional<size_t> batch_verify(std::span<const plonk::proof> proofs);
     transcript::Manifest manifest;
 
     std::shared_ptr<verification_key> key;
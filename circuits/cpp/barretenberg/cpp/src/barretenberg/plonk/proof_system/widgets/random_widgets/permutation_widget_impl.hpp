@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
+#include "barretenberg/ecc/fields/field_vector.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/plonk/proof_system/public_inputs/public_inputs.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
@@ -239,12 +240,16 @@ void ProverPermutationWidget<program_width, idpolys, num_roots_cut_out_of_vanish
         barretenberg::fr inversion_accumulator = fr::one();
         constexpr size_t inversion_index = (program_width == 1) ? 2 : program_width * 2 - 1;
         fr* inversion_coefficients = &accumulators[inversion_index][0];
+        using fr_vector = barretenberg::field_vector<fr::Params>;
+        // The column products are element-wise, so are done a row range at a time with the vectorised arithmetic.
+        for (size_t k = 1; k < program_width; ++k) {
+            fr_vector::mul(&accumulators[0][start], &accumulators[0][start], &accumulators[k][start], end - start);
+            fr_vector::mul(&accumulators[program_width][start],
+                           &accumulators[program_width][start],
+                           &accumulators[program_width + k][start],
+                           end - start);
+        }
         for (size_t i = start; i < end; ++i) {
-
-            for (size_t k = 1; k < program_width; ++k) {
-                accumulators[0][i] *= accumulators[k][i];
-                accumulators[program_width][i] *= accumulators[program_width + k][i];
-            }
             inversion_coefficients[i] = accumulators[0][i] * inversion_accumulator;
             inversion_accumulator *= accumulators[program_width][i];
         }
@@ -35,6 +35,15 @@ template <typename Fr> class Polynomial {
     // Allow polynomials to be entirely reset/dormant
     Polynomial() = default;
 
+    /**
+     * @brief Wraps existing memory (e.g. a memory mapped file) rather than allocating and copying. The memory must
+     * hold capacity() coefficients, the last of them zero, and stays alive for as long as any polynomial using it.
+     */
+    Polynomial(pointer coefficients, const size_t size)
+        : coefficients_(std::move(coefficients))
+        , size_(size)
+    {}
+
     /**
      * @brief Create the degree-(m-1) polynomial T(X) that interpolates the given evaluations.
      * We have T(xⱼ) = yⱼ for j=1,...,m
@@ -3,11 +3,14 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/fields/field_vector.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "iterate_over_domain.hpp"
+#include <algorithm>
 #include <math.h>
 #include <memory.h>
 #include <memory>
+#include <mutex>
 
 namespace barretenberg::polynomial_arithmetic {
 
@@ -20,16 +23,197 @@ template <typename Fr> std::shared_ptr<Fr[]> get_scratch_space(const size_t num_
 #ifdef __wasm__
     return std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
 #else
-    static std::shared_ptr<Fr[]> working_memory = nullptr;
-    static size_t current_size = 0;
-    if (num_elements > current_size) {
-        working_memory = std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
-        current_size = num_elements;
+    // Buffers are pooled rather than shared, so that FFTs can run concurrently (e.g. several proofs in one process).
+    // A buffer returns to the pool when the last copy of the pointer handed out here is released.
+    static std::mutex pool_mutex;
+    static std::vector<std::pair<std::shared_ptr<Fr[]>, size_t>> pool;
+
+    std::shared_ptr<Fr[]> buffer;
+    size_t buffer_size = 0;
+    {
+        std::lock_guard lock(pool_mutex);
+        for (auto it = pool.begin(); it != pool.end(); ++it) {
+            if (it->second >= num_elements) {
+                std::tie(buffer, buffer_size) = std::move(*it);
+                pool.erase(it);
+                break;
+            }
+        }
+        if (!buffer && !pool.empty()) {
+            // Nothing is large enough: drop a smaller buffer, to be replaced by the one allocated below.
+            pool.pop_back();
+        }
+    }
+    if (!buffer) {
+        buffer = std::static_pointer_cast<Fr[]>(get_mem_slab(num_elements * sizeof(Fr)));
+        buffer_size = num_elements;
     }
-    return working_memory;
+    Fr* data = buffer.get();
+    return std::shared_ptr<Fr[]>(data, [buffer = std::move(buffer), buffer_size](Fr*) mutable {
+        std::lock_guard lock(pool_mutex);
+        pool.emplace_back(std::move(buffer), buffer_size);
+    });
 #endif
 }
 
+// Eight FFT butterflies at once: (lo, hi) = (lo_in + root * hi_in, lo_in - root * hi_in), element-wise over eight
+// consecutive elements, so the twiddle multiplications can use the vectorised field arithmetic. Outputs may alias the
+// inputs they replace.
+constexpr size_t BUTTERFLY_BLOCK = 8;
+
+template <typename Fr> inline void butterfly_block(Fr* lo, Fr* hi, const Fr* lo_in, const Fr* hi_in, const Fr* roots)
+{
+    using vector = field_vector<typename Fr::Params>;
+    Fr temp[BUTTERFLY_BLOCK];
+    vector::mul(temp, roots, hi_in, BUTTERFLY_BLOCK);
+    vector::sub(hi, lo_in, temp, BUTTERFLY_BLOCK);
+    vector::add(lo, lo_in, temp, BUTTERFLY_BLOCK);
+}
+
+// Large FFTs are cache blocked: the early rounds are run a block of FFT_BLOCK_SIZE elements (128KiB of 256-bit field
+// elements, which stays in L2) at a time, and the later rounds two at a time. Used for domains with at least two
+// blocks per thread; smaller ones fit in cache as they are.
+constexpr size_t FFT_BLOCK_SIZE = 1UL << 12;
+
+template <typename Fr> inline bool use_blocked_fft(const EvaluationDomain<Fr>& domain)
+{
+    return domain.size >= 2 * FFT_BLOCK_SIZE * domain.num_threads;
+}
+
+/**
+ * @brief Runs the rounds of a (bit reversed, decimation in time) FFT that combine elements at distance 2 <= m <
+ * min(m_end, FFT_BLOCK_SIZE), on each of polys. These only mix elements within aligned blocks of FFT_BLOCK_SIZE, so
+ * rather than sweeping over all of memory once per round, each thread takes its blocks through all of them one block
+ * at a time.
+ */
+template <typename Fr>
+void fft_blocked_rounds(const std::vector<Fr*>& polys,
+                        const size_t size,
+                        const size_t m_end,
+                        const size_t num_threads,
+                        const std::vector<Fr*>& root_table)
+{
+    const size_t blocks_per_thread = size / FFT_BLOCK_SIZE / num_threads;
+    const size_t round_end = std::min(m_end, FFT_BLOCK_SIZE);
+    parallel_for(num_threads, [&](size_t j) {
+        for (size_t b = j * blocks_per_thread; b < (j + 1) * blocks_per_thread; ++b) {
+            for (Fr* poly : polys) {
+                Fr* block = &poly[b * FFT_BLOCK_SIZE];
+                for (size_t m = 2; m < round_end; m <<= 1) {
+                    const Fr* round_roots = root_table[static_cast<size_t>(numeric::get_msb(m)) - 1];
+                    for (size_t k = 0; k < FFT_BLOCK_SIZE; k += 2 * m) {
+                        Fr* lo = &block[k];
+                        if (m >= BUTTERFLY_BLOCK) {
+                            for (size_t i = 0; i < m; i += BUTTERFLY_BLOCK) {
+                                butterfly_block(lo + i, lo + i + m, lo + i, lo + i + m, &round_roots[i]);
+                            }
+                            continue;
+                        }
+                        for (size_t i = 0; i < m; ++i) {
+                            Fr temp = round_roots[i] * lo[i + m];
+                            lo[i + m] = lo[i] - temp;
+                            lo[i] += temp;
+                        }
+                    }
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Runs rounds m and 2m of an FFT on each of polys in one sweep over memory (a radix-4 pass): each group of four
+ * elements at distance m is taken through the butterflies of both rounds while it is still in L1, and the roots for a
+ * group are loaded once for all of the polynomials. Needs m >= BUTTERFLY_BLOCK.
+ */
+template <typename Fr>
+void fft_radix_4_round(const std::vector<Fr*>& polys,
+                       const size_t size,
+                       const size_t m,
+                       const size_t num_threads,
+                       const std::vector<Fr*>& root_table)
+{
+    const size_t log2_m = static_cast<size_t>(numeric::get_msb(m));
+    const Fr* roots_m = root_table[log2_m - 1];
+    const Fr* roots_2m = root_table[log2_m];
+    const size_t groups_per_thread = (size >> 2) / num_threads;
+    parallel_for(num_threads, [&](size_t j) {
+        for (size_t i = j * groups_per_thread; i < (j + 1) * groups_per_thread; i += BUTTERFLY_BLOCK) {
+            const size_t offset = i & (m - 1);
+            const size_t index = ((i >> log2_m) << (log2_m + 2)) + offset;
+            for (Fr* poly : polys) {
+                Fr* x_0 = &poly[index];
+                Fr* x_1 = x_0 + m;
+                Fr* x_2 = x_1 + m;
+                Fr* x_3 = x_2 + m;
+                butterfly_block(x_0, x_1, x_0, x_1, &roots_m[offset]);
+                butterfly_block(x_2, x_3, x_2, x_3, &roots_m[offset]);
+                butterfly_block(x_0, x_2, x_0, x_2, &roots_2m[offset]);
+                butterfly_block(x_1, x_3, x_1, x_3, &roots_2m[offset + m]);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Runs the rounds 2 <= m < m_end of a large FFT in place on each of polys, with the cache blocked rounds and
+ * radix-4 passes above, and returns the first round left to run (which, when m_end is the last round, is left to the
+ * caller).
+ */
+template <typename Fr>
+size_t fft_blocked(const std::vector<Fr*>& polys,
+                   const size_t size,
+                   const size_t m_end,
+                   const size_t num_threads,
+                   const std::vector<Fr*>& root_table)
+{
+    fft_blocked_rounds(polys, size, m_end, num_threads, root_table);
+    size_t m = FFT_BLOCK_SIZE;
+    for (; 2 * m < m_end; m <<= 2) {
+        fft_radix_4_round(polys, size, m, num_threads, root_table);
+    }
+    return m;
+}
+
+/**
+ * @brief Runs round m >= 2 of an FFT on each of polys, in place, loading each root once for all of the polynomials.
+ */
+template <typename Fr>
+void fft_radix_2_round(const std::vector<Fr*>& polys,
+                       const size_t size,
+                       const size_t m,
+                       const size_t num_threads,
+                       const std::vector<Fr*>& root_table)
+{
+    const size_t log2_m = static_cast<size_t>(numeric::get_msb(m));
+    const Fr* round_roots = root_table[log2_m - 1];
+    const size_t butterflies_per_thread = (size >> 1) / num_threads;
+    parallel_for(num_threads, [&](size_t j) {
+        const size_t start = j * butterflies_per_thread;
+        const size_t end = start + butterflies_per_thread;
+        if (m >= BUTTERFLY_BLOCK && (butterflies_per_thread & (BUTTERFLY_BLOCK - 1)) == 0) {
+            for (size_t i = start; i < end; i += BUTTERFLY_BLOCK) {
+                const size_t offset = i & (m - 1);
+                const size_t index = ((i >> log2_m) << (log2_m + 1)) + offset;
+                for (Fr* poly : polys) {
+                    Fr* lo = &poly[index];
+                    butterfly_block(lo, lo + m, lo, lo + m, &round_roots[offset]);
+                }
+            }
+            return;
+        }
+        for (size_t i = start; i < end; ++i) {
+            const size_t offset = i & (m - 1);
+            const size_t index = ((i >> log2_m) << (log2_m + 1)) + offset;
+            for (Fr* poly : polys) {
+                Fr temp = round_roots[offset] * poly[index + m];
+                poly[index + m] = poly[index] - temp;
+                poly[index] += temp;
+            }
+        }
+    });
+}
+
 } // namespace
 
 inline uint32_t reverse_bits(uint32_t x, uint32_t bit_length)
@@ -216,8 +400,14 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
         coeffs[0][1] = scratch_space[1];
     }
 
+    // All but the last round, which writes to coeffs, can be run in place by the cache blocked engine.
+    const size_t first_round =
+        use_blocked_fft(domain)
+            ? fft_blocked<Fr>({ scratch_space }, domain.size, domain.size >> 1, domain.num_threads, root_table)
+            : 2;
+
     // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
+    for (size_t m = first_round; m < (domain.size); m <<= 1) {
         parallel_for(domain.num_threads, [&](size_t j) {
             Fr temp;
 
@@ -269,7 +459,19 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
             // Finally, we want to treat the final round differently from the others,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
+            // Once rounds have at least BUTTERFLY_BLOCK butterflies per block, runs of that many consecutive
+            // butterflies use consecutive roots and elements, so can be processed a block at a time.
+            const bool use_blocks = m >= BUTTERFLY_BLOCK && ((start | end) & (BUTTERFLY_BLOCK - 1)) == 0;
             if (m != (domain.size >> 1)) {
+                if (use_blocks) {
+                    for (size_t i = start; i < end; i += BUTTERFLY_BLOCK) {
+                        size_t k1 = (i & index_mask) << 1;
+                        size_t j1 = i & block_mask;
+                        Fr* lo = &scratch_space[k1 + j1];
+                        butterfly_block(lo, lo + m, lo, lo + m, &round_roots[j1]);
+                    }
+                    return;
+                }
                 for (size_t i = start; i < end; ++i) {
                     size_t k1 = (i & index_mask) << 1;
                     size_t j1 = i & block_mask;
@@ -278,6 +480,21 @@ void fft_inner_parallel(std::vector<Fr*> coeffs,
                     scratch_space[k1 + j1] += temp;
                 }
             } else {
+                // Blocks of outputs must also not straddle two of the output polynomials.
+                if (use_blocks && poly_size >= BUTTERFLY_BLOCK) {
+                    for (size_t i = start; i < end; i += BUTTERFLY_BLOCK) {
+                        size_t k1 = (i & index_mask) << 1;
+                        size_t j1 = i & block_mask;
+                        const size_t index_1 = k1 + j1;
+                        const size_t index_2 = k1 + j1 + m;
+                        butterfly_block(&coeffs[index_1 >> log2_poly_size][index_1 & poly_mask],
+                                        &coeffs[index_2 >> log2_poly_size][index_2 & poly_mask],
+                                        &scratch_space[index_1],
+                                        &scratch_space[index_2],
+                                        &round_roots[j1]);
+                    }
+                    return;
+                }
                 for (size_t i = start; i < end; ++i) {
                     size_t k1 = (i & index_mask) << 1;
                     size_t j1 = i & block_mask;
@@ -327,8 +544,13 @@ void fft_inner_parallel(
         coeffs[1] = target[1];
     }
 
+    const size_t first_round =
+        use_blocked_fft(domain)
+            ? fft_blocked<Fr>({ target }, domain.size, domain.size, domain.num_threads, root_table)
+            : 2;
+
     // outer FFT loop
-    for (size_t m = 2; m < (domain.size); m <<= 1) {
+    for (size_t m = first_round; m < (domain.size); m <<= 1) {
         parallel_for(domain.num_threads, [&](size_t j) {
             Fr temp;
 
@@ -380,6 +602,15 @@ void fft_inner_parallel(
             // Finally, we want to treat the final round differently from the others,
             // so that we can reduce out of our 'coarse' reduction and store the output in `coeffs` instead of
             // `scratch_space`
+            if (m >= BUTTERFLY_BLOCK && ((start | end) & (BUTTERFLY_BLOCK - 1)) == 0) {
+                for (size_t i = start; i < end; i += BUTTERFLY_BLOCK) {
+                    size_t k1 = (i & index_mask) << 1;
+                    size_t j1 = i & block_mask;
+                    Fr* lo = &target[k1 + j1];
+                    butterfly_block(lo, lo + m, lo, lo + m, &round_roots[j1]);
+                }
+                return;
+            }
             for (size_t i = start; i < end; ++i) {
                 size_t k1 = (i & index_mask) << 1;
                 size_t j1 = i & block_mask;
@@ -622,6 +853,70 @@ void coset_fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain)
     fft(coeffs, domain);
 }
 
+/**
+ * @brief FFT each of several polynomials over the same domain, in place. This is one transform scheduled over all of
+ * them, rather than one after another: every index computation and root of unity load is shared, and each block of
+ * the cache blocked engine is taken through its rounds for every polynomial while the roots it needs are in cache.
+ *
+ * @details Unlike fft(std::vector<Fr*>, domain), which transforms a single polynomial split into pieces, each pointer
+ * here is a separate polynomial of domain.size coefficients.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    const auto& root_table = domain.get_round_roots();
+
+    // Bit reverse in place, then run the first round, whose roots are all one.
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t i = j * domain.thread_size; i < (j + 1) * domain.thread_size; ++i) {
+            const size_t swap_index = reverse_bits((uint32_t)i, (uint32_t)domain.log2_size);
+            if (i < swap_index) {
+                for (Fr* poly : polys) {
+                    Fr::__swap(poly[i], poly[swap_index]);
+                }
+            }
+        }
+    });
+    parallel_for(domain.num_threads, [&](size_t j) {
+        for (size_t i = j * domain.thread_size; i < (j + 1) * domain.thread_size; i += 2) {
+            for (Fr* poly : polys) {
+                Fr temp = poly[i + 1];
+                poly[i + 1] = poly[i] - temp;
+                poly[i] += temp;
+            }
+        }
+    });
+
+    size_t m =
+        use_blocked_fft(domain) ? fft_blocked(polys, domain.size, domain.size, domain.num_threads, root_table) : 2;
+    for (; m < domain.size; m <<= 1) {
+        fft_radix_2_round(polys, domain.size, m, domain.num_threads, root_table);
+    }
+}
+
+/**
+ * @brief Coset FFT each of several polynomials over the same domain, in place (see batch_fft). The powers of the coset
+ * generator are also computed once for all of the polynomials.
+ */
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain)
+{
+    const size_t generator_size_per_thread = domain.generator_size / domain.num_threads;
+    parallel_for(domain.num_threads, [&](size_t j) {
+        const size_t offset = j * generator_size_per_thread;
+        Fr work_generator = domain.generator.pow(static_cast<uint64_t>(offset));
+        for (size_t i = offset; i < offset + generator_size_per_thread; ++i) {
+            for (Fr* poly : polys) {
+                poly[i] *= work_generator;
+            }
+            work_generator *= domain.generator;
+        }
+    });
+    batch_fft(polys, domain);
+}
+
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(Fr* coeffs,
@@ -1378,6 +1673,8 @@ template void fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&)
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+template void batch_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+template void batch_coset_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
 template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
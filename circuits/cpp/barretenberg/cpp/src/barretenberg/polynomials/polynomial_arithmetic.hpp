@@ -61,6 +61,12 @@ void coset_fft(Fr* coeffs, Fr* target, const EvaluationDomain<Fr>& domain);
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(std::vector<Fr*> coeffs, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
+template <typename Fr>
+    requires SupportsFFT<Fr>
+void batch_coset_fft(const std::vector<Fr*>& polys, const EvaluationDomain<Fr>& domain);
 template <typename Fr>
     requires SupportsFFT<Fr>
 void coset_fft(Fr* coeffs,
@@ -391,6 +397,8 @@ extern template void fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, con
 extern template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(fr*, fr*, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(std::vector<fr*>, const EvaluationDomain<fr>&);
+extern template void batch_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
+extern template void batch_coset_fft<fr>(const std::vector<fr*>&, const EvaluationDomain<fr>&);
 extern template void coset_fft<fr>(fr*, const EvaluationDomain<fr>&, const EvaluationDomain<fr>&, const size_t);
 extern template void coset_fft_with_constant<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
 extern template void coset_fft_with_generator_shift<fr>(fr*, const EvaluationDomain<fr>&, const fr&);
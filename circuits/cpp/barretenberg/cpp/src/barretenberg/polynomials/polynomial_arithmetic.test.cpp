@@ -117,6 +117,69 @@ TEST(polynomials, basic_fft)
     aligned_free(data);
 }
 
+// Large enough to be computed by the cache blocked FFT (on up to 16 threads).
+TEST(polynomials, blocked_fft)
+{
+    constexpr size_t n = 1 << 17;
+    constexpr size_t num_pieces = 4;
+    // Powers of a random element make for random looking coefficients, much faster than random_element().
+    const fr seed = fr::random_element();
+    std::vector<fr> coeffs(n);
+    fr power = seed;
+    for (auto& coeff : coeffs) {
+        coeff = power;
+        power *= seed;
+    }
+    std::vector<fr> result(coeffs);
+    std::vector<fr> split_result(coeffs);
+
+    auto domain = evaluation_domain(n);
+    domain.compute_lookup_table();
+    polynomial_arithmetic::fft(result.data(), domain);
+    std::vector<fr*> pieces;
+    for (size_t i = 0; i < num_pieces; ++i) {
+        pieces.emplace_back(&split_result[i * (n / num_pieces)]);
+    }
+    polynomial_arithmetic::fft(pieces, domain);
+
+    EXPECT_EQ(split_result, result);
+    for (size_t i : { 0UL, 1UL, 4095UL, 4096UL, n / 2 + 3, n - 1 }) {
+        EXPECT_EQ(result[i], polynomial_arithmetic::evaluate(coeffs.data(), domain.root.pow(i), n));
+    }
+
+    polynomial_arithmetic::ifft(result.data(), domain);
+    EXPECT_EQ(result, coeffs);
+}
+
+// A batched coset FFT agrees with coset FFTs of each polynomial, for domains computed by the cache blocked FFT and not.
+TEST(polynomials, batch_coset_fft)
+{
+    constexpr size_t num_polys = 3;
+    const fr seed = fr::random_element();
+    for (size_t n : { 16UL, 1UL << 17 }) {
+        std::vector<std::vector<fr>> expected(num_polys, std::vector<fr>(n));
+        fr power = seed;
+        for (auto& poly : expected) {
+            for (auto& coeff : poly) {
+                coeff = power;
+                power *= seed;
+            }
+        }
+        auto results = expected;
+
+        auto domain = evaluation_domain(n);
+        domain.compute_lookup_table();
+        std::vector<fr*> polys;
+        for (size_t i = 0; i < num_polys; ++i) {
+            polynomial_arithmetic::coset_fft(expected[i].data(), domain);
+            polys.emplace_back(results[i].data());
+        }
+        polynomial_arithmetic::batch_coset_fft(polys, domain);
+
+        EXPECT_EQ(results, expected);
+    }
+}
+
 TEST(polynomials, fft_ifft_consistency)
 {
     constexpr size_t n = 256;
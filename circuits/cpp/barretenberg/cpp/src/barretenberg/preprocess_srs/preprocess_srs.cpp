@@ -0,0 +1,36 @@
+#include "barretenberg/srs/factories/file_crs_factory.hpp"
+
+#include <string>
+#include <vector>
+
+/**
+ * @brief Writes the preprocessed (memory-mappable) form of an SRS next to its transcripts.
+ *
+ * @details Provers using a FileCrsFactory on the same directory will then map the pippenger point table read-only,
+ * instead of reading and expanding the transcripts at startup. The table serves any number of points up to
+ * `num_points`, and is specific to the endianness and field representation of the host that wrote it.
+ */
+int main(int argc, char** argv)
+{
+    std::vector<std::string> args(argv, argv + argc);
+    if (args.size() <= 1) {
+        info("usage: ", args[0], " <num_points> [srs_path] [bn254|grumpkin]");
+        return 1;
+    }
+
+    const size_t num_points = (size_t)std::stoul(args[1]);
+    const std::string curve_name = (args.size() > 3) ? args[3] : "bn254";
+    const std::string srs_path = (args.size() > 2) ? args[2]
+                                 : curve_name == "grumpkin" ? "../srs_db/grumpkin"
+                                                       : "../srs_db/ignition";
+
+    if (curve_name == "bn254") {
+        barretenberg::srs::factories::write_preprocessed_transcript<curve::BN254>(srs_path, num_points);
+    } else if (curve_name == "grumpkin") {
+        barretenberg::srs::factories::write_preprocessed_transcript<curve::Grumpkin>(srs_path, num_points);
+    } else {
+        info("unknown curve: ", curve_name);
+        return 1;
+    }
+    return 0;
+}
@@ -32,15 +32,15 @@ void CircuitBuilderBase<Arithmetization>::assert_equal(const uint32_t a_variable
     update_real_variable_indices(b_start_idx, a_real_idx);
     // Now merge equivalence classes of a and b by tying last (= real) element of b-chain to first element of a-chain
     auto a_start_idx = get_first_variable_in_class(a_variable_idx);
-    next_var_index[b_real_idx] = a_start_idx;
-    prev_var_index[a_start_idx] = b_real_idx;
+    set_variable_entry(&CircuitBuilderBase::next_var_index, b_real_idx, a_start_idx);
+    set_variable_entry(&CircuitBuilderBase::prev_var_index, a_start_idx, b_real_idx);
     bool no_tag_clash = (real_variable_tags[a_real_idx] == DUMMY_TAG || real_variable_tags[b_real_idx] == DUMMY_TAG ||
                          real_variable_tags[a_real_idx] == real_variable_tags[b_real_idx]);
     if (!no_tag_clash && !failed()) {
         failure(msg);
     }
     if (real_variable_tags[a_real_idx] == DUMMY_TAG)
-        real_variable_tags[a_real_idx] = real_variable_tags[b_real_idx];
+        set_variable_entry(&CircuitBuilderBase::real_variable_tags, a_real_idx, real_variable_tags[b_real_idx]);
 }
 // Standard honk/ plonk instantiation
 template class CircuitBuilderBase<arithmetization::Standard<barretenberg::fr>>;
@@ -1,4 +1,6 @@
 #pragma once
+#include "barretenberg/common/chunked_vector.hpp"
+#include "barretenberg/common/flat_hash_map.hpp"
 #include "barretenberg/common/slab_allocator.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/proof_system/arithmetization/arithmetization.hpp"
@@ -8,6 +10,13 @@
 namespace proof_system {
 static constexpr uint32_t DUMMY_TAG = 0;
 
+/**
+ * @brief Hashes a field element by the low limb of its reduced form, which is what operator== compares.
+ */
+template <typename FF> struct FieldHash {
+    size_t operator()(const FF& x) const { return static_cast<size_t>(x.reduce_once().data[0]); }
+};
+
 template <typename Arithmetization> class CircuitBuilderBase {
   public:
     using FF = typename Arithmetization::FF;
@@ -25,19 +34,33 @@ template <typename Arithmetization> class CircuitBuilderBase {
     typename Arithmetization::Selectors selectors;
 
     std::vector<uint32_t> public_inputs;
-    std::vector<FF> variables;
+    // Per-variable data is held in chunked storage, so adding a variable never reallocates and copies the ones before
+    // it. Large circuits add millions of variables one at a time.
+    barretenberg::ChunkedVector<FF> variables;
     // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
-    std::vector<uint32_t> next_var_index;
+    barretenberg::ChunkedVector<uint32_t> next_var_index;
     // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-    std::vector<uint32_t> prev_var_index;
+    barretenberg::ChunkedVector<uint32_t> prev_var_index;
     // indices of corresponding real variables
-    std::vector<uint32_t> real_variable_index;
-    std::vector<uint32_t> real_variable_tags;
+    barretenberg::ChunkedVector<uint32_t> real_variable_index;
+    barretenberg::ChunkedVector<uint32_t> real_variable_tags;
     uint32_t current_tag = DUMMY_TAG;
     // The permutation on variable tags. See
     // https://github.com/AztecProtocol/plonk-with-lookups-private/blob/new-stuff/GenPermuations.pdf
     // DOCTODO(#231): replace with the relevant wiki link.
-    std::map<uint32_t, uint32_t> tau;
+    // Tags are handed out consecutively from DUMMY_TAG, so tau is stored densely: tau[tag] is the image of tag.
+    std::vector<uint32_t> tau;
+
+    // An entry of one of the per-variable index arrays above, as it was before it was last overwritten
+    struct VariableEntryWrite {
+        barretenberg::ChunkedVector<uint32_t> CircuitBuilderBase::*array;
+        uint32_t index;
+        uint32_t old_value;
+    };
+    // Undo log of writes to variables that existed when the most recent checkpoint was taken; see checkpoint_base()
+    std::vector<VariableEntryWrite> variable_journal;
+    // Writes to variables below this index are logged. Zero when no checkpoint is active.
+    size_t journaled_num_variables = 0;
 
     // Publicin put indices which contain recursive proof information
     std::vector<uint32_t> recursive_proof_public_input_indices;
@@ -55,12 +78,32 @@ template <typename Arithmetization> class CircuitBuilderBase {
 
     CircuitBuilderBase(std::vector<std::string> selector_names, size_t size_hint = 0)
         : selector_names_(std::move(selector_names))
+    {
+        reserve_from_size_hint(size_hint);
+    }
+
+    CircuitBuilderBase(const CircuitBuilderBase& other) = default;
+    CircuitBuilderBase(CircuitBuilderBase&& other) noexcept = default;
+    CircuitBuilderBase& operator=(const CircuitBuilderBase& other) = default;
+    CircuitBuilderBase& operator=(CircuitBuilderBase&& other) noexcept = default;
+    virtual ~CircuitBuilderBase() = default;
+
+    /**
+     * @brief Allocates up front the storage a circuit of about size_hint gates needs, so building it does not grow
+     * storage as it goes.
+     *
+     * @details Circuits add about three variables per gate, and one entry to every wire and selector.
+     */
+    void reserve_from_size_hint(size_t size_hint)
     {
         variables.reserve(size_hint * 3);
         next_var_index.reserve(size_hint * 3);
         prev_var_index.reserve(size_hint * 3);
         real_variable_index.reserve(size_hint * 3);
         real_variable_tags.reserve(size_hint * 3);
+        for (auto& wire : wires) {
+            wire.reserve(size_hint);
+        }
         // We set selectors type to bool, when we don't actually use them
         if constexpr (!std::is_same<typename Arithmetization::Selectors, bool>::value) {
             for (auto& p : selectors) {
@@ -69,12 +112,6 @@ template <typename Arithmetization> class CircuitBuilderBase {
         }
     }
 
-    CircuitBuilderBase(const CircuitBuilderBase& other) = default;
-    CircuitBuilderBase(CircuitBuilderBase&& other) noexcept = default;
-    CircuitBuilderBase& operator=(const CircuitBuilderBase& other) = default;
-    CircuitBuilderBase& operator=(CircuitBuilderBase&& other) noexcept = default;
-    virtual ~CircuitBuilderBase() = default;
-
     virtual size_t get_num_gates() const { return num_gates; }
     virtual void print_num_gates() const { std::cout << num_gates << std::endl; }
     virtual size_t get_num_variables() const { return variables.size(); }
@@ -112,7 +149,7 @@ template <typename Arithmetization> class CircuitBuilderBase {
     {
         auto cur_index = index;
         do {
-            real_variable_index[cur_index] = new_real_index;
+            set_variable_entry(&CircuitBuilderBase::real_variable_index, cur_index, new_real_index);
             cur_index = next_var_index[cur_index];
         } while (cur_index != REAL_VARIABLE);
     }
@@ -289,6 +326,94 @@ template <typename Arithmetization> class CircuitBuilderBase {
         }
     }
 
+    /**
+     * @brief Sets an entry of one of the per-variable index arrays, logging its old value if a checkpoint taken before
+     * the variable was added may need it back.
+     */
+    void set_variable_entry(barretenberg::ChunkedVector<uint32_t> CircuitBuilderBase::*array,
+                            uint32_t index,
+                            uint32_t value)
+    {
+        uint32_t& entry = (this->*array)[index];
+        if (index < journaled_num_variables) {
+            variable_journal.push_back({ array, index, entry });
+        }
+        entry = value;
+    }
+
+    /**
+     * @brief The state of CircuitBuilderBase that a checkpoint rolls back to.
+     *
+     * @details Nothing proportional to the number of variables is copied: variables added after the checkpoint are
+     * dropped by truncation, and writes to older ones are undone from variable_journal. Variable values themselves are
+     * not journaled; only witness assignment overwrites them in place.
+     */
+    struct BaseCheckpoint {
+        size_t num_gates = 0;
+        size_t num_variables = 0;
+        size_t num_public_inputs = 0;
+        size_t journal_size = 0;
+        size_t previously_journaled_num_variables = 0;
+        uint32_t current_tag = DUMMY_TAG;
+        std::vector<uint32_t> tau;
+        bool failed = false;
+        std::string err;
+    };
+
+    /**
+     * @brief Records the current state and starts journaling writes to the variables it holds. Checkpoints nest, and
+     * must be released in the reverse of the order they were taken in.
+     */
+    BaseCheckpoint checkpoint_base()
+    {
+        BaseCheckpoint checkpoint{ .num_gates = num_gates,
+                                   .num_variables = variables.size(),
+                                   .num_public_inputs = public_inputs.size(),
+                                   .journal_size = variable_journal.size(),
+                                   .previously_journaled_num_variables = journaled_num_variables,
+                                   .current_tag = current_tag,
+                                   .tau = tau,
+                                   .failed = _failed,
+                                   .err = _err };
+        journaled_num_variables = variables.size();
+        return checkpoint;
+    }
+
+    /**
+     * @brief Rolls back to checkpoint, which stays active, so the builder can be rolled back to it again.
+     */
+    void restore_base(const BaseCheckpoint& checkpoint)
+    {
+        while (variable_journal.size() > checkpoint.journal_size) {
+            const auto& write = variable_journal.back();
+            (this->*write.array)[write.index] = write.old_value;
+            variable_journal.pop_back();
+        }
+        variables.truncate(checkpoint.num_variables);
+        next_var_index.truncate(checkpoint.num_variables);
+        prev_var_index.truncate(checkpoint.num_variables);
+        real_variable_index.truncate(checkpoint.num_variables);
+        real_variable_tags.truncate(checkpoint.num_variables);
+        public_inputs.resize(checkpoint.num_public_inputs);
+        num_gates = checkpoint.num_gates;
+        current_tag = checkpoint.current_tag;
+        tau = checkpoint.tau;
+        _failed = checkpoint.failed;
+        _err = checkpoint.err;
+        journaled_num_variables = checkpoint.num_variables;
+    }
+
+    /**
+     * @brief Stops journaling for checkpoint, keeping the state the builder is in.
+     */
+    void release_base(const BaseCheckpoint& checkpoint)
+    {
+        journaled_num_variables = checkpoint.previously_journaled_num_variables;
+        if (journaled_num_variables == 0) {
+            variable_journal.clear();
+        }
+    }
+
     bool failed() const { return _failed; };
     const std::string& err() const { return _err; };
 
@@ -39,14 +39,11 @@ template <typename FF> class StandardCircuitBuilder_ : public CircuitBuilderBase
     // These are variables that we have used a gate on, to enforce that they are
     // equal to a defined value.
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
-    std::map<FF, uint32_t> constant_variable_indices;
+    FlatHashMap<FF, uint32_t, FieldHash<FF>> constant_variable_indices;
 
     StandardCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<arithmetization::Standard<FF>>(standard_selector_names(), size_hint)
     {
-        w_l.reserve(size_hint);
-        w_r.reserve(size_hint);
-        w_o.reserve(size_hint);
         // To effieciently constrain wires to zero, we set the first value of w_1 to be 0, and use copy constraints for
         // all future zero values.
         // (#216)(Adrian): This should be done in a constant way, maybe by initializing the constant_variable_indices
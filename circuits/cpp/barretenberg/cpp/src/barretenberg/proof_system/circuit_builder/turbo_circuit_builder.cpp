@@ -16,11 +16,6 @@ template <typename FF>
 TurboCircuitBuilder_<FF>::TurboCircuitBuilder_(const size_t size_hint)
     : CircuitBuilderBase<arithmetization::Turbo<FF>>(turbo_selector_names(), size_hint)
 {
-    w_l.reserve(size_hint);
-    w_r.reserve(size_hint);
-    w_o.reserve(size_hint);
-    w_4.reserve(size_hint);
-
     this->zero_idx = put_constant_variable(FF::zero());
 }
 
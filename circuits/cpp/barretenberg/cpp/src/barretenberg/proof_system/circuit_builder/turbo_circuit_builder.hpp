@@ -121,7 +121,7 @@ template <typename FF> class TurboCircuitBuilder_ : public CircuitBuilderBase<ar
     }
 
     // these are variables that we have used a gate on, to enforce that they are equal to a defined value
-    std::map<FF, uint32_t> constant_variable_indices;
+    FlatHashMap<FF, uint32_t, FieldHash<FF>> constant_variable_indices;
 };
 extern template class TurboCircuitBuilder_<barretenberg::fr>;
 using TurboCircuitBuilder = TurboCircuitBuilder_<barretenberg::fr>;
@@ -50,6 +50,75 @@ template <typename FF> void UltraCircuitBuilder_<FF>::finalize_circuit()
     }
 }
 
+/**
+ * @brief Records the current state, so the builder can later be rolled back to it with restore_checkpoint().
+ *
+ * @details Taking a checkpoint costs time and memory in proportion to the memory transcripts, range lists and cached
+ * non-native multiplications, not to the whole circuit. Writes to variables that exist at the checkpoint are journaled
+ * until it is released. Checkpoints nest, and must be released in the reverse of the order they were taken in. A
+ * circuit prefix can be checkpointed once and restored any number of times, e.g. to build different suffixes on it.
+ */
+template <typename FF> typename UltraCircuitBuilder_<FF>::Checkpoint UltraCircuitBuilder_<FF>::checkpoint()
+{
+    Checkpoint checkpoint{ .base = this->checkpoint_base(),
+                           .num_ecc_op_gates = num_ecc_op_gates,
+                           .num_constant_variables = constant_variable_indices.size(),
+                           .num_lookup_tables = lookup_tables.size(),
+                           .num_lookup_gates = {},
+                           .num_memory_read_records = memory_read_records.size(),
+                           .num_memory_write_records = memory_write_records.size(),
+                           .ram_arrays = ram_arrays,
+                           .rom_arrays = rom_arrays,
+                           .range_lists = range_lists,
+                           .cached_partial_non_native_field_multiplications =
+                               cached_partial_non_native_field_multiplications,
+                           .circuit_finalised = circuit_finalised };
+    checkpoint.num_lookup_gates.reserve(lookup_tables.size());
+    for (const auto& table : lookup_tables) {
+        checkpoint.num_lookup_gates.emplace_back(table.lookup_gates.size());
+    }
+    return checkpoint;
+}
+
+/**
+ * @brief Rolls the builder back to checkpoint. The checkpoint stays active, so it can be restored again.
+ */
+template <typename FF> void UltraCircuitBuilder_<FF>::restore_checkpoint(const Checkpoint& checkpoint)
+{
+    this->restore_base(checkpoint.base);
+    for (auto& wire : this->wires) {
+        wire.resize(this->num_gates);
+    }
+    for (auto& selector : this->selectors) {
+        selector.resize(this->num_gates);
+    }
+    num_ecc_op_gates = checkpoint.num_ecc_op_gates;
+    for (auto& wire : ecc_op_wires) {
+        wire.resize(num_ecc_op_gates);
+    }
+    constant_variable_indices.truncate(checkpoint.num_constant_variables);
+    lookup_tables.erase(lookup_tables.begin() + static_cast<std::ptrdiff_t>(checkpoint.num_lookup_tables),
+                        lookup_tables.end());
+    for (size_t i = 0; i < lookup_tables.size(); ++i) {
+        lookup_tables[i].lookup_gates.resize(checkpoint.num_lookup_gates[i]);
+    }
+    memory_read_records.resize(checkpoint.num_memory_read_records);
+    memory_write_records.resize(checkpoint.num_memory_write_records);
+    ram_arrays = checkpoint.ram_arrays;
+    rom_arrays = checkpoint.rom_arrays;
+    range_lists = checkpoint.range_lists;
+    cached_partial_non_native_field_multiplications = checkpoint.cached_partial_non_native_field_multiplications;
+    circuit_finalised = checkpoint.circuit_finalised;
+}
+
+/**
+ * @brief Stops journaling for checkpoint, keeping the state the builder is in.
+ */
+template <typename FF> void UltraCircuitBuilder_<FF>::release_checkpoint(const Checkpoint& checkpoint)
+{
+    this->release_base(checkpoint.base);
+}
+
 /**
  * @brief Ensure all polynomials have at least one non-zero coefficient to avoid commiting to the zero-polynomial
  *
@@ -867,12 +936,16 @@ void UltraCircuitBuilder_<FF>::create_new_range_constraint(const uint32_t variab
             this->failure(msg);
         }
     }
-    if (range_lists.count(target_range) == 0) {
-        range_lists.insert({ target_range, create_range_list(target_range) });
+    auto list_it = std::lower_bound(range_lists.begin(),
+                                    range_lists.end(),
+                                    target_range,
+                                    [](const auto& entry, const uint64_t range) { return entry.first < range; });
+    if (list_it == range_lists.end() || list_it->first != target_range) {
+        list_it = range_lists.insert(list_it, { target_range, create_range_list(target_range) });
     }
 
     const auto existing_tag = this->real_variable_tags[this->real_variable_index[variable_index]];
-    auto& list = range_lists[target_range];
+    auto& list = list_it->second;
 
     // If the variable's tag matches the target range list's tag, do nothing.
     if (existing_tag != list.range_tag) {
@@ -982,7 +1055,7 @@ template <typename FF> void UltraCircuitBuilder_<FF>::process_range_lists()
   *
   * create range constraint parameters: variable index && range size
   *
-  * std::map<uint64_t, RangeList> range_lists;
+  * std::vector<std::pair<uint64_t, RangeList>> range_lists;
 */
 // Check for a sequence of variables that neighboring differences are at most 3 (used for batched range checkj)
 template <typename FF>
@@ -3275,8 +3348,8 @@ inline FF UltraCircuitBuilder_<FF>::compute_auxilary_identity(FF q_aux_value,
 template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
 {
     bool result = true;
-    CircuitDataBackup circuit_backup = CircuitDataBackup::store_prefinilized_state(this);
-    // Finalize circuit-in-the-head
+    // Finalize circuit-in-the-head, and roll the finalization back once the circuit is checked
+    const Checkpoint prefinalized_state = checkpoint();
 
     finalize_circuit();
 
@@ -3531,7 +3604,8 @@ template <typename FF> bool UltraCircuitBuilder_<FF>::check_circuit()
 
         result = false;
     }
-    circuit_backup.restore_prefinilized_state(this);
+    restore_checkpoint(prefinalized_state);
+    release_checkpoint(prefinalized_state);
     return result;
 }
 template class UltraCircuitBuilder_<barretenberg::fr>;
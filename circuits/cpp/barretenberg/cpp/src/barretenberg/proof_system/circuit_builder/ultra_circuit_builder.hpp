@@ -233,27 +233,24 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
     };
 
     /**
-     * @brief CircuitDataBackup is a structure we use to store all the information about the circuit that is needed
-     * to restore it back to a pre-finalized state
-     * @details In check_circuit method in UltraCircuitBuilder we want to check that the whole circuit works,
-     * but ultra circuits need to have ram, rom and range gates added in the end for the check to be complete as
-     * well as the set permutation check, so we finalize the circuit when we check it. This structure allows us to
-     * restore the circuit to the state before the finalization.
+     * @brief CircuitDataBackup is a full copy of everything logic-related in the builder
+     * @details Tests use it to check that check_circuit, which finalizes the circuit in the head and then rolls the
+     * finalization back to a Checkpoint, leaves the builder exactly as it found it.
      */
     struct CircuitDataBackup {
         using WireVector = std::vector<uint32_t, barretenberg::ContainerSlabAllocator<uint32_t>>;
         using SelectorVector = std::vector<FF, barretenberg::ContainerSlabAllocator<FF>>;
 
         std::vector<uint32_t> public_inputs;
-        std::vector<FF> variables;
+        barretenberg::ChunkedVector<FF> variables;
         // index of next variable in equivalence class (=REAL_VARIABLE if you're last)
-        std::vector<uint32_t> next_var_index;
+        barretenberg::ChunkedVector<uint32_t> next_var_index;
         // index of  previous variable in equivalence class (=FIRST if you're in a cycle alone)
-        std::vector<uint32_t> prev_var_index;
+        barretenberg::ChunkedVector<uint32_t> prev_var_index;
         // indices of corresponding real variables
-        std::vector<uint32_t> real_variable_index;
-        std::vector<uint32_t> real_variable_tags;
-        std::map<FF, uint32_t> constant_variable_indices;
+        barretenberg::ChunkedVector<uint32_t> real_variable_index;
+        barretenberg::ChunkedVector<uint32_t> real_variable_tags;
+        FlatHashMap<FF, uint32_t, FieldHash<FF>> constant_variable_indices;
         WireVector w_l;
         WireVector w_r;
         WireVector w_o;
@@ -270,14 +267,14 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
         SelectorVector q_aux;
         SelectorVector q_lookup_type;
         uint32_t current_tag = DUMMY_TAG;
-        std::map<uint32_t, uint32_t> tau;
+        std::vector<uint32_t> tau;
 
         std::vector<RamTranscript> ram_arrays;
         std::vector<RomTranscript> rom_arrays;
 
         std::vector<uint32_t> memory_read_records;
         std::vector<uint32_t> memory_write_records;
-        std::map<uint64_t, RangeList> range_lists;
+        std::vector<std::pair<uint64_t, RangeList>> range_lists;
 
         std::vector<UltraCircuitBuilder_::cached_partial_non_native_field_multiplication>
             cached_partial_non_native_field_multiplications;
@@ -337,90 +334,6 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
             return stored_state;
         }
 
-        /**
-         * @brief Stores the state of all members of the circuit constructor that are needed to restore the state
-         * after finalizing the circuit.
-         *
-         * @param builder
-         * @return CircuitDataBackup
-         */
-        template <typename CircuitBuilder>
-        static CircuitDataBackup store_prefinilized_state(const CircuitBuilder* builder)
-        {
-            CircuitDataBackup stored_state;
-            stored_state.public_inputs = builder->public_inputs;
-            stored_state.variables = builder->variables;
-
-            stored_state.next_var_index = builder->next_var_index;
-
-            stored_state.prev_var_index = builder->prev_var_index;
-
-            stored_state.real_variable_index = builder->real_variable_index;
-            stored_state.real_variable_tags = builder->real_variable_tags;
-            stored_state.constant_variable_indices = builder->constant_variable_indices;
-            stored_state.current_tag = builder->current_tag;
-            stored_state.tau = builder->tau;
-
-            stored_state.ram_arrays = builder->ram_arrays;
-            stored_state.rom_arrays = builder->rom_arrays;
-
-            stored_state.memory_read_records = builder->memory_read_records;
-            stored_state.memory_write_records = builder->memory_write_records;
-            stored_state.range_lists = builder->range_lists;
-            stored_state.circuit_finalised = builder->circuit_finalised;
-            stored_state.num_gates = builder->num_gates;
-            stored_state.cached_partial_non_native_field_multiplications =
-                builder->cached_partial_non_native_field_multiplications;
-
-            return stored_state;
-        }
-
-        /**
-         * @brief Restores circuit constructor to a prefinilized state.
-         *
-         * @param builder
-         * @return CircuitDataBackup
-         */
-        template <typename CircuitBuilder> void restore_prefinilized_state(CircuitBuilder* builder)
-        {
-            builder->public_inputs = public_inputs;
-            builder->variables = variables;
-
-            builder->next_var_index = next_var_index;
-
-            builder->prev_var_index = prev_var_index;
-
-            builder->real_variable_index = real_variable_index;
-            builder->real_variable_tags = real_variable_tags;
-            builder->constant_variable_indices = constant_variable_indices;
-            builder->current_tag = current_tag;
-            builder->tau = tau;
-
-            builder->ram_arrays = ram_arrays;
-            builder->rom_arrays = rom_arrays;
-
-            builder->memory_read_records = memory_read_records;
-            builder->memory_write_records = memory_write_records;
-            builder->range_lists = range_lists;
-            builder->circuit_finalised = circuit_finalised;
-            builder->num_gates = num_gates;
-            builder->cached_partial_non_native_field_multiplications = cached_partial_non_native_field_multiplications;
-            builder->w_l.resize(num_gates);
-            builder->w_r.resize(num_gates);
-            builder->w_o.resize(num_gates);
-            builder->w_4.resize(num_gates);
-            builder->q_m.resize(num_gates);
-            builder->q_c.resize(num_gates);
-            builder->q_1.resize(num_gates);
-            builder->q_2.resize(num_gates);
-            builder->q_3.resize(num_gates);
-            builder->q_4.resize(num_gates);
-            builder->q_arith.resize(num_gates);
-            builder->q_sort.resize(num_gates);
-            builder->q_elliptic.resize(num_gates);
-            builder->q_aux.resize(num_gates);
-            builder->q_lookup_type.resize(num_gates);
-        }
         /**
          * @brief Checks that the circuit state is the same as the stored circuit's one
          *
@@ -531,6 +444,29 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
         }
     };
 
+    /**
+     * @brief A state the builder can be rolled back to; see checkpoint().
+     *
+     * @details Only what finalization rewrites in place is copied: the memory transcripts, range lists and cached
+     * non-native multiplications, whose size is set by the number of those operations rather than by the size of the
+     * circuit. Everything else is only ever appended to, so it is rolled back by truncation, and the variables use the
+     * journal in CircuitBuilderBase. The ECC op queue is not rolled back.
+     */
+    struct Checkpoint {
+        typename CircuitBuilderBase<arithmetization::Ultra<FF>>::BaseCheckpoint base;
+        size_t num_ecc_op_gates = 0;
+        size_t num_constant_variables = 0;
+        size_t num_lookup_tables = 0;
+        std::vector<size_t> num_lookup_gates;
+        size_t num_memory_read_records = 0;
+        size_t num_memory_write_records = 0;
+        std::vector<RamTranscript> ram_arrays;
+        std::vector<RomTranscript> rom_arrays;
+        std::vector<std::pair<uint64_t, RangeList>> range_lists;
+        std::vector<cached_partial_non_native_field_multiplication> cached_partial_non_native_field_multiplications;
+        bool circuit_finalised = false;
+    };
+
     using WireVector = std::vector<uint32_t, ContainerSlabAllocator<uint32_t>>;
     using SelectorVector = std::vector<FF, ContainerSlabAllocator<FF>>;
 
@@ -562,11 +498,13 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
     // These are variables that we have used a gate on, to enforce that they are
     // equal to a defined value.
     // TODO(#216)(Adrian): Why is this not in CircuitBuilderBase
-    std::map<FF, uint32_t> constant_variable_indices;
+    FlatHashMap<FF, uint32_t, FieldHash<FF>> constant_variable_indices;
 
     std::vector<plookup::BasicTable> lookup_tables;
     std::vector<plookup::MultiTable> lookup_multi_tables;
-    std::map<uint64_t, RangeList> range_lists; // DOCTODO: explain this.
+    // The range constraint lists, one per distinct range, kept sorted by range: the order they are processed in at
+    // finalisation fixes the gate layout, so it must not depend on the order the ranges were first used in.
+    std::vector<std::pair<uint64_t, RangeList>> range_lists;
 
     /**
      * @brief Each entry in ram_arrays represents an independent RAM table.
@@ -598,12 +536,8 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
     UltraCircuitBuilder_(const size_t size_hint = 0)
         : CircuitBuilderBase<arithmetization::Ultra<FF>>(ultra_selector_names(), size_hint)
     {
-        w_l.reserve(size_hint);
-        w_r.reserve(size_hint);
-        w_o.reserve(size_hint);
-        w_4.reserve(size_hint);
         this->zero_idx = put_constant_variable(FF::zero());
-        this->tau.insert({ DUMMY_TAG, DUMMY_TAG }); // TODO(luke): explain this
+        this->tau.push_back(DUMMY_TAG); // tau[DUMMY_TAG] = DUMMY_TAG. TODO(luke): explain this
     };
     UltraCircuitBuilder_(const UltraCircuitBuilder_& other) = delete;
     UltraCircuitBuilder_(UltraCircuitBuilder_&& other)
@@ -642,6 +576,10 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
 
     void finalize_circuit();
 
+    Checkpoint checkpoint();
+    void restore_checkpoint(const Checkpoint& checkpoint);
+    void release_checkpoint(const Checkpoint& checkpoint);
+
     void add_gates_to_ensure_all_polys_are_non_zero();
 
     void create_add_gate(const add_triple_<FF>& in) override;
@@ -1062,12 +1000,16 @@ template <typename FF> class UltraCircuitBuilder_ : public CircuitBuilderBase<ar
             return;
         }
         ASSERT(this->real_variable_tags[this->real_variable_index[variable_index]] == DUMMY_TAG);
-        this->real_variable_tags[this->real_variable_index[variable_index]] = tag;
+        this->set_variable_entry(
+            &UltraCircuitBuilder_::real_variable_tags, this->real_variable_index[variable_index], tag);
     }
 
     uint32_t create_tag(const uint32_t tag_index, const uint32_t tau_index)
     {
-        this->tau.insert({ tag_index, tau_index });
+        if (tag_index >= this->tau.size()) {
+            this->tau.resize(tag_index + 1, DUMMY_TAG);
+        }
+        this->tau[tag_index] = tau_index;
         this->current_tag++; // Why exactly?
         return this->current_tag;
     }
@@ -795,6 +795,81 @@ TEST(ultra_circuit_constructor, range_checks_on_duplicates)
     EXPECT_EQ(result, true);
 }
 
+TEST(ultra_circuit_constructor, range_lists_are_sorted_by_range)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+
+    const std::vector<uint64_t> ranges = { 500, 10, 1000, 10, 50, 500 };
+    std::vector<uint32_t> indices;
+    for (const auto range : ranges) {
+        indices.push_back(circuit_constructor.add_variable(range / 2));
+        circuit_constructor.create_new_range_constraint(indices.back(), range);
+    }
+    // Tighten the range of an already range constrained variable, which copies it into the new range's list
+    indices.push_back(circuit_constructor.add_variable(7));
+    circuit_constructor.create_new_range_constraint(indices.back(), 1000);
+    circuit_constructor.create_new_range_constraint(indices.back(), 8);
+    circuit_constructor.create_dummy_constraints(indices);
+
+    std::vector<uint64_t> list_ranges;
+    for (const auto& [range, list] : circuit_constructor.range_lists) {
+        EXPECT_EQ(range, list.target_range);
+        list_ranges.push_back(range);
+    }
+    EXPECT_EQ(list_ranges, std::vector<uint64_t>({ 8, 10, 50, 500, 1000 }));
+
+    EXPECT_EQ(circuit_constructor.put_constant_variable(42), circuit_constructor.put_constant_variable(42));
+
+    bool result = circuit_constructor.check_circuit();
+    EXPECT_EQ(result, true);
+}
+
+TEST(ultra_circuit_constructor, checkpoint_restores_prefix)
+{
+    UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
+
+    // The prefix: a ROM array, a range constraint and a copy constraint
+    std::vector<uint32_t> prefix_indices;
+    for (size_t i = 0; i < 4; ++i) {
+        prefix_indices.push_back(circuit_constructor.add_variable(fr(i + 1)));
+    }
+    const size_t rom_id = circuit_constructor.create_ROM_array(4);
+    for (size_t i = 0; i < 4; ++i) {
+        circuit_constructor.set_ROM_element(rom_id, i, prefix_indices[i]);
+    }
+    circuit_constructor.create_new_range_constraint(prefix_indices[3], 10);
+    const uint32_t copy_idx = circuit_constructor.add_variable(fr(1));
+    circuit_constructor.assert_equal(prefix_indices[0], copy_idx);
+    circuit_constructor.create_dummy_constraints(prefix_indices);
+
+    auto saved_state = UltraCircuitBuilder::CircuitDataBackup::store_full_state(circuit_constructor);
+    const auto checkpoint = circuit_constructor.checkpoint();
+
+    // Each suffix reads the ROM array, merges copy cycles of prefix variables, tags a prefix variable with a new
+    // range and adds a constant, all of which write to state the prefix already holds
+    const auto add_suffix = [&](const uint64_t rom_index) {
+        const uint32_t index_idx = circuit_constructor.add_variable(rom_index);
+        const uint32_t read_idx = circuit_constructor.read_ROM_array(rom_id, index_idx);
+        const uint32_t sum_idx = circuit_constructor.add_variable(circuit_constructor.get_variable(read_idx) + 1);
+        circuit_constructor.create_add_gate(
+            { read_idx, circuit_constructor.put_constant_variable(1), sum_idx, 1, 1, -1, 0 });
+        circuit_constructor.assert_equal(prefix_indices[rom_index], read_idx);
+        circuit_constructor.create_new_range_constraint(prefix_indices[2], 50);
+        circuit_constructor.create_new_range_constraint(sum_idx, 50);
+    };
+
+    for (const uint64_t rom_index : { 1UL, 3UL }) {
+        add_suffix(rom_index);
+        EXPECT_FALSE(saved_state.is_same_state(circuit_constructor));
+        EXPECT_TRUE(circuit_constructor.check_circuit());
+        circuit_constructor.restore_checkpoint(checkpoint);
+        EXPECT_TRUE(saved_state.is_same_state(circuit_constructor));
+    }
+    circuit_constructor.release_checkpoint(checkpoint);
+    EXPECT_TRUE(circuit_constructor.variable_journal.empty());
+    EXPECT_TRUE(circuit_constructor.check_circuit());
+}
+
 TEST(ultra_circuit_constructor, check_circuit_showcase)
 {
     UltraCircuitBuilder circuit_constructor = UltraCircuitBuilder();
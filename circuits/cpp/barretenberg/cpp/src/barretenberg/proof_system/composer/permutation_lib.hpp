@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/proving_key.hpp"
 #include "barretenberg/polynomials/iterate_over_domain.hpp"
@@ -14,9 +15,11 @@
 #include "barretenberg/proof_system/flavor/flavor.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <initializer_list>
+#include <span>
 #include <string>
 #include <utility>
 #include <vector>
@@ -56,34 +59,42 @@ template <size_t NUM_WIRES> struct PermutationMapping {
     Mapping ids;
 };
 
-using CyclicPermutation = std::vector<cycle_node>;
+/**
+ * @brief The copy cycles of a circuit, one per variable, stored flat rather than as a vector per variable: the nodes of
+ * cycle i are nodes[offsets[i]], ..., nodes[offsets[i + 1] - 1].
+ */
+struct CopyCycles {
+    std::vector<size_t> offsets;
+    std::vector<cycle_node> nodes;
+
+    size_t size() const { return offsets.size() - 1; }
+    std::span<const cycle_node> operator[](size_t cycle_index) const
+    {
+        return { nodes.data() + offsets[cycle_index], nodes.data() + offsets[cycle_index + 1] };
+    }
+};
 
 namespace {
 
+// The minimum number of gates, cycles or rows handed to a thread by the parallel loops below
+constexpr size_t PERMUTATION_GRAIN_SIZE = 1 << 12;
+
 /**
- * @brief Compute all CyclicPermutations of the circuit. Each CyclicPermutation represents the indices of the values in
- * the witness wires that must have the same value.    using Curve = curve::BN254;
-    using FF = Curve::ScalarField;
-    using Polynomial = barretenberg::Polynomial<FF>;
- *
- * @tparam program_width Program width
- *
- * */
-template <typename Flavor>
-std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::CircuitBuilder& circuit_constructor)
+ * @brief Calls add_node(variable_index, node) for every wire value of the execution trace that is copy constrained.
+ * If multithreaded, the nodes of the "real" gates are visited in parallel, so add_node must be thread safe.
+ */
+template <typename Flavor, typename AddNode>
+void for_each_copy_cycle_node(const typename Flavor::CircuitBuilder& circuit_constructor,
+                              const bool multithreaded,
+                              const AddNode& add_node)
 {
     // Reference circuit constructor members
     const size_t num_gates = circuit_constructor.num_gates;
     std::span<const uint32_t> public_inputs = circuit_constructor.public_inputs;
     const size_t num_public_inputs = public_inputs.size();
 
-    // Each variable represents one cycle
-    const size_t number_of_cycles = circuit_constructor.variables.size();
-    std::vector<CyclicPermutation> copy_cycles(number_of_cycles);
-    copy_cycles.reserve(num_gates * 3);
-
     // Represents the index of a variable in circuit_constructor.variables
-    std::span<const uint32_t> real_variable_index = circuit_constructor.real_variable_index;
+    const auto& real_variable_index = circuit_constructor.real_variable_index;
 
     // For some flavors, we need to ensure the value in the 0th index of each wire is 0 to allow for left-shift by 1. To
     // do this, we add the wires of the first gate in the execution trace to the "zero index" copy cycle.
@@ -92,7 +103,7 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::C
             const auto wire_index = static_cast<uint32_t>(wire_idx);
             const uint32_t gate_index = 0;                          // place zeros at 0th index
             const uint32_t zero_idx = circuit_constructor.zero_idx; // index of constant zero in variables
-            copy_cycles[zero_idx].emplace_back(cycle_node{ wire_index, gate_index });
+            add_node(zero_idx, cycle_node{ wire_index, gate_index });
         }
     }
 
@@ -116,10 +127,10 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::C
             // TODO(luke): Kesha pointed out that we may need to constrain the op code values in some way, either with a
             // copy cycle that constrains them to a constant or with a relation. Resolve this.
             for (size_t op_wire_idx = 1; op_wire_idx < 4; ++op_wire_idx) {
-                const uint32_t var_index = circuit_constructor.real_variable_index[op_wires[op_wire_idx][i]];
+                const uint32_t var_index = real_variable_index[op_wires[op_wire_idx][i]];
                 const auto wire_index = static_cast<uint32_t>(op_wire_idx);
                 const auto gate_idx = static_cast<uint32_t>(i + op_gates_offset);
-                copy_cycles[var_index].emplace_back(cycle_node{ wire_index, gate_idx });
+                add_node(var_index, cycle_node{ wire_index, gate_idx });
             }
         }
     }
@@ -140,26 +151,96 @@ std::vector<CyclicPermutation> compute_wire_copy_cycles(const typename Flavor::C
         const uint32_t public_input_index = real_variable_index[public_inputs[i]];
         const auto gate_index = static_cast<uint32_t>(i + pub_inputs_offset);
         // These two nodes must be in adjacent locations in the cycle for correct handling of public inputs
-        copy_cycles[public_input_index].emplace_back(cycle_node{ 0, gate_index });
-        copy_cycles[public_input_index].emplace_back(cycle_node{ 1, gate_index });
+        add_node(public_input_index, cycle_node{ 0, gate_index });
+        add_node(public_input_index, cycle_node{ 1, gate_index });
     }
 
     // Iterate over all variables of the "real" gates, and add a corresponding node to the cycle for that variable
-    for (size_t i = 0; i < num_gates; ++i) {
-        size_t wire_idx = 0;
-        for (auto& wire : circuit_constructor.wires) {
-            // We are looking at the j-th wire in the i-th row.
-            // The value in this position should be equal to the value of the element at index `var_index`
-            // of the `constructor.variables` vector.
-            // Therefore, we add (i,j) to the cycle at index `var_index` to indicate that w^j_i should have the values
-            // constructor.variables[var_index].
-            const uint32_t var_index = circuit_constructor.real_variable_index[wire[i]];
-            const auto wire_index = static_cast<uint32_t>(wire_idx);
-            const auto gate_idx = static_cast<uint32_t>(i + gates_offset);
-            copy_cycles[var_index].emplace_back(cycle_node{ wire_index, gate_idx });
-            ++wire_idx;
+    const auto add_gate_nodes = [&](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            size_t wire_idx = 0;
+            for (auto& wire : circuit_constructor.wires) {
+                // We are looking at the j-th wire in the i-th row.
+                // The value in this position should be equal to the value of the element at index `var_index`
+                // of the `constructor.variables` vector.
+                // Therefore, we add (i,j) to the cycle at index `var_index` to indicate that w^j_i should have the
+                // values constructor.variables[var_index].
+                const uint32_t var_index = real_variable_index[wire[i]];
+                const auto wire_index = static_cast<uint32_t>(wire_idx);
+                const auto gate_idx = static_cast<uint32_t>(i + gates_offset);
+                add_node(var_index, cycle_node{ wire_index, gate_idx });
+                ++wire_idx;
+            }
         }
+    };
+    if (multithreaded) {
+        parallel_for_range(num_gates, add_gate_nodes, PERMUTATION_GRAIN_SIZE);
+    } else {
+        add_gate_nodes(0, num_gates);
     }
+}
+
+/**
+ * @brief Compute all CyclicPermutations of the circuit. Each CyclicPermutation represents the indices of the values in
+ * the witness wires that must have the same value.
+ *
+ * @details The execution trace is walked twice, in parallel when there are threads to share the work: once to count
+ * the nodes of each cycle, which gives the offsets of the cycles in one flat array, and once to place the nodes. Within
+ * a cycle, nodes are ordered by their row and then by their wire, which is the order the rows are laid out in; parallel
+ * placement can scramble that, so any cycle left out of order is sorted back.
+ *
+ * @tparam Flavor
+ */
+template <typename Flavor>
+CopyCycles compute_wire_copy_cycles(const typename Flavor::CircuitBuilder& circuit_constructor)
+{
+    // Each variable represents one cycle
+    const size_t number_of_cycles = circuit_constructor.variables.size();
+
+    // Locked increments cost as much as the rest of the walk, so they are only used when the walk is shared out
+    const bool multithreaded = get_num_cpus() > 1;
+    std::vector<std::atomic<uint32_t>> cycle_sizes(number_of_cycles);
+    const auto increment_cycle_size = [&](uint32_t var_index) -> uint32_t {
+        if (multithreaded) {
+            return cycle_sizes[var_index].fetch_add(1, std::memory_order_relaxed);
+        }
+        const uint32_t cycle_size = cycle_sizes[var_index].load(std::memory_order_relaxed);
+        cycle_sizes[var_index].store(cycle_size + 1, std::memory_order_relaxed);
+        return cycle_size;
+    };
+
+    for_each_copy_cycle_node<Flavor>(
+        circuit_constructor, multithreaded, [&](uint32_t var_index, cycle_node) { increment_cycle_size(var_index); });
+
+    CopyCycles copy_cycles;
+    copy_cycles.offsets.resize(number_of_cycles + 1);
+    copy_cycles.offsets[0] = 0;
+    for (size_t i = 0; i < number_of_cycles; ++i) {
+        copy_cycles.offsets[i + 1] = copy_cycles.offsets[i] + cycle_sizes[i].load(std::memory_order_relaxed);
+        cycle_sizes[i].store(0, std::memory_order_relaxed);
+    }
+
+    copy_cycles.nodes.resize(copy_cycles.offsets[number_of_cycles]);
+    for_each_copy_cycle_node<Flavor>(circuit_constructor, multithreaded, [&](uint32_t var_index, cycle_node node) {
+        copy_cycles.nodes[copy_cycles.offsets[var_index] + increment_cycle_size(var_index)] = node;
+    });
+
+    const auto node_order = [](const cycle_node& a, const cycle_node& b) {
+        return a.gate_index < b.gate_index || (a.gate_index == b.gate_index && a.wire_index < b.wire_index);
+    };
+    parallel_for_range(
+        number_of_cycles,
+        [&](size_t start, size_t end) {
+            for (size_t i = start; i < end; ++i) {
+                auto cycle_begin = copy_cycles.nodes.begin() + static_cast<std::ptrdiff_t>(copy_cycles.offsets[i]);
+                auto cycle_end = copy_cycles.nodes.begin() + static_cast<std::ptrdiff_t>(copy_cycles.offsets[i + 1]);
+                if (!std::is_sorted(cycle_begin, cycle_end, node_order)) {
+                    std::sort(cycle_begin, cycle_end, node_order);
+                }
+            }
+        },
+        PERMUTATION_GRAIN_SIZE);
+
     return copy_cycles;
 }
 
@@ -187,66 +268,75 @@ PermutationMapping<Flavor::NUM_WIRES> compute_permutation_mapping(
 
     // Initialize the table of permutations so that every element points to itself
     for (size_t i = 0; i < Flavor::NUM_WIRES; ++i) { // TODO(#391) zip and split
-        mapping.sigmas[i].reserve(proving_key->circuit_size);
+        mapping.sigmas[i].resize(proving_key->circuit_size);
         if constexpr (generalized) {
-            mapping.ids[i].reserve(proving_key->circuit_size);
+            mapping.ids[i].resize(proving_key->circuit_size);
         }
-
-        for (size_t j = 0; j < proving_key->circuit_size; ++j) {
-            mapping.sigmas[i].emplace_back(permutation_subgroup_element{ .row_index = static_cast<uint32_t>(j),
+    }
+    parallel_for_range(
+        proving_key->circuit_size,
+        [&](size_t start, size_t end) {
+            for (size_t i = 0; i < Flavor::NUM_WIRES; ++i) {
+                for (size_t j = start; j < end; ++j) {
+                    mapping.sigmas[i][j] = permutation_subgroup_element{ .row_index = static_cast<uint32_t>(j),
                                                                          .column_index = static_cast<uint8_t>(i),
                                                                          .is_public_input = false,
-                                                                         .is_tag = false });
-            if constexpr (generalized) {
-                mapping.ids[i].emplace_back(permutation_subgroup_element{ .row_index = static_cast<uint32_t>(j),
+                                                                         .is_tag = false };
+                    if constexpr (generalized) {
+                        mapping.ids[i][j] = permutation_subgroup_element{ .row_index = static_cast<uint32_t>(j),
                                                                           .column_index = static_cast<uint8_t>(i),
                                                                           .is_public_input = false,
-                                                                          .is_tag = false });
+                                                                          .is_tag = false };
+                    }
+                }
             }
-        }
-    }
+        },
+        PERMUTATION_GRAIN_SIZE);
 
     // Represents the index of a variable in circuit_constructor.variables (needed only for generalized)
-    std::span<const uint32_t> real_variable_tags = circuit_constructor.real_variable_tags;
-
-    // Go through each cycle
-    size_t cycle_index = 0;
-    for (auto& copy_cycle : wire_copy_cycles) {
-        for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
-            // Get the indices of the current node and next node in the cycle
-            cycle_node current_cycle_node = copy_cycle[node_idx];
-            // If current node is the last one in the cycle, then the next one is the first one
-            size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
-            cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
-            const auto current_row = current_cycle_node.gate_index;
-            const auto next_row = next_cycle_node.gate_index;
-
-            const auto current_column = current_cycle_node.wire_index;
-            const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
-            // Point current node to the next node
-            mapping.sigmas[current_column][current_row] = {
-                .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
-            };
-
-            if constexpr (generalized) {
-                bool first_node = (node_idx == 0);
-                bool last_node = (next_cycle_node_index == 0);
-
-                if (first_node) {
-                    mapping.ids[current_column][current_row].is_tag = true;
-                    mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
-                }
-                if (last_node) {
-                    mapping.sigmas[current_column][current_row].is_tag = true;
-
-                    // TODO(Zac): yikes, std::maps (tau) are expensive. Can we find a way to get rid of this?
-                    mapping.sigmas[current_column][current_row].row_index =
-                        circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+    const auto& real_variable_tags = circuit_constructor.real_variable_tags;
+
+    // Go through each cycle. Every entry of the mapping belongs to exactly one cycle, so cycles are processed in
+    // parallel without any two threads writing the same entry.
+    parallel_for_range(
+        wire_copy_cycles.size(),
+        [&](size_t start, size_t end) {
+            for (size_t cycle_index = start; cycle_index < end; ++cycle_index) {
+                const auto copy_cycle = wire_copy_cycles[cycle_index];
+                for (size_t node_idx = 0; node_idx < copy_cycle.size(); ++node_idx) {
+                    // Get the indices of the current node and next node in the cycle
+                    cycle_node current_cycle_node = copy_cycle[node_idx];
+                    // If current node is the last one in the cycle, then the next one is the first one
+                    size_t next_cycle_node_index = (node_idx == copy_cycle.size() - 1 ? 0 : node_idx + 1);
+                    cycle_node next_cycle_node = copy_cycle[next_cycle_node_index];
+                    const auto current_row = current_cycle_node.gate_index;
+                    const auto next_row = next_cycle_node.gate_index;
+
+                    const auto current_column = current_cycle_node.wire_index;
+                    const auto next_column = static_cast<uint8_t>(next_cycle_node.wire_index);
+                    // Point current node to the next node
+                    mapping.sigmas[current_column][current_row] = {
+                        .row_index = next_row, .column_index = next_column, .is_public_input = false, .is_tag = false
+                    };
+
+                    if constexpr (generalized) {
+                        bool first_node = (node_idx == 0);
+                        bool last_node = (next_cycle_node_index == 0);
+
+                        if (first_node) {
+                            mapping.ids[current_column][current_row].is_tag = true;
+                            mapping.ids[current_column][current_row].row_index = (real_variable_tags[cycle_index]);
+                        }
+                        if (last_node) {
+                            mapping.sigmas[current_column][current_row].is_tag = true;
+                            mapping.sigmas[current_column][current_row].row_index =
+                                circuit_constructor.tau.at(real_variable_tags[cycle_index]);
+                        }
+                    }
                 }
             }
-        }
-        cycle_index++;
-    }
+        },
+        PERMUTATION_GRAIN_SIZE);
 
     // Add information about public inputs to the computation
     const auto num_public_inputs = static_cast<uint32_t>(circuit_constructor.public_inputs.size());
@@ -289,8 +379,9 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
     using FF = typename Flavor::FF;
     const size_t num_gates = proving_key->circuit_size;
 
-    size_t wire_index = 0;
-    for (auto& current_permutation_poly : permutation_polynomials) {
+    // The polynomials are filled concurrently, each of them in parallel over the domain
+    parallel_for(permutation_polynomials.size(), [&](size_t wire_index) {
+        auto& current_permutation_poly = permutation_polynomials[wire_index];
         ITERATE_OVER_DOMAIN_START(proving_key->evaluation_domain);
         const auto& current_mapping = permutation_mappings[wire_index][i];
         if (current_mapping.is_public_input) {
@@ -312,8 +403,7 @@ void compute_honk_style_permutation_lagrange_polynomials_from_mapping(
             current_permutation_poly[i] = FF(current_mapping.row_index + num_gates * current_mapping.column_index);
         }
         ITERATE_OVER_DOMAIN_END;
-        wire_index++;
-    }
+    });
 }
 } // namespace
 
@@ -406,11 +496,17 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
     std::array<std::vector<permutation_subgroup_element>, program_width>& mappings,
     plonk::proving_key* key)
 {
+    std::vector<barretenberg::polynomial> polynomials_lagrange;
+    for (size_t i = 0; i < program_width; i++) {
+        polynomials_lagrange.emplace_back(key->circuit_size);
+    }
+    // The polynomials are computed concurrently, each of them in parallel over the domain
+    parallel_for(program_width, [&](size_t i) {
+        compute_standard_plonk_lagrange_polynomial(polynomials_lagrange[i], mappings[i], key->small_domain);
+    });
     for (size_t i = 0; i < program_width; i++) {
         std::string index = std::to_string(i + 1);
-        barretenberg::polynomial polynomial_lagrange(key->circuit_size);
-        compute_standard_plonk_lagrange_polynomial(polynomial_lagrange, mappings[i], key->small_domain);
-        key->polynomial_store.put(label + "_" + index + "_lagrange", std::move(polynomial_lagrange));
+        key->polynomial_store.put(label + "_" + index + "_lagrange", std::move(polynomials_lagrange[i]));
     }
 }
 
@@ -426,23 +522,37 @@ void compute_plonk_permutation_lagrange_polynomials_from_mapping(
 template <size_t program_width>
 void compute_monomial_and_coset_fft_polynomials_from_lagrange(std::string label, plonk::proving_key* key)
 {
+    std::vector<barretenberg::polynomial> sigma_polynomials_lagrange;
+    std::vector<barretenberg::polynomial> sigma_polynomials;
     for (size_t i = 0; i < program_width; ++i) {
-        std::string index = std::to_string(i + 1);
-        std::string prefix = label + "_" + index;
-
         // Construct permutation polynomials in lagrange base
-        auto sigma_polynomial_lagrange = key->polynomial_store.get(prefix + "_lagrange");
-        // Compute permutation polynomial monomial form
-        barretenberg::polynomial sigma_polynomial(key->circuit_size);
+        sigma_polynomials_lagrange.emplace_back(
+            key->polynomial_store.get(label + "_" + std::to_string(i + 1) + "_lagrange"));
+        sigma_polynomials.emplace_back(key->circuit_size);
+    }
+
+    // Compute the permutation polynomials' monomial forms, the transforms running concurrently
+    parallel_for(program_width, [&](size_t i) {
         barretenberg::polynomial_arithmetic::ifft(
-            (barretenberg::fr*)&sigma_polynomial_lagrange[0], &sigma_polynomial[0], key->small_domain);
+            &sigma_polynomials_lagrange[i][0], &sigma_polynomials[i][0], key->small_domain);
+    });
+
+    std::vector<barretenberg::polynomial> sigma_ffts;
+    for (auto& sigma_polynomial : sigma_polynomials) {
+        sigma_ffts.emplace_back(sigma_polynomial, key->large_domain.size);
+    }
 
-        // Compute permutation polynomial coset FFT form
-        barretenberg::polynomial sigma_fft(sigma_polynomial, key->large_domain.size);
-        sigma_fft.coset_fft(key->large_domain);
+    // Compute the permutation polynomials' coset FFT forms, all in one batch
+    std::vector<barretenberg::fr*> sigma_fft_coefficients;
+    for (auto& sigma_fft : sigma_ffts) {
+        sigma_fft_coefficients.push_back(sigma_fft.data().get());
+    }
+    barretenberg::polynomial_arithmetic::batch_coset_fft(sigma_fft_coefficients, key->large_domain);
 
-        key->polynomial_store.put(prefix, std::move(sigma_polynomial));
-        key->polynomial_store.put(prefix + "_fft", std::move(sigma_fft));
+    for (size_t i = 0; i < program_width; ++i) {
+        std::string prefix = label + "_" + std::to_string(i + 1);
+        key->polynomial_store.put(prefix, std::move(sigma_polynomials[i]));
+        key->polynomial_store.put(prefix + "_fft", std::move(sigma_ffts[i]));
     }
 }
 
@@ -67,8 +67,42 @@ class PermutationHelperTests : public ::testing::Test {
 
 TEST_F(PermutationHelperTests, ComputeWireCopyCycles)
 {
-    // TODO(#425) Flesh out these tests
-    compute_wire_copy_cycles<Flavor>(circuit_constructor);
+    // Enough gates, sharing variables, for the gates to be split between threads
+    std::vector<uint32_t> shared_variables;
+    for (size_t i = 0; i < 16; ++i) {
+        shared_variables.push_back(circuit_constructor.add_variable(i));
+    }
+    for (size_t i = 0; i < 10000; ++i) {
+        circuit_constructor.create_add_gate(
+            { shared_variables[i % 16], shared_variables[(i + 1) % 16], shared_variables[(i + 2) % 16], 0, 0, 0, 0 });
+    }
+
+    auto copy_cycles = compute_wire_copy_cycles<Flavor>(circuit_constructor);
+    EXPECT_EQ(copy_cycles.size(), circuit_constructor.variables.size());
+
+    // Every wire value of every gate, and both copies of each public input, is in exactly one cycle
+    const size_t num_zero_rows = Flavor::has_zero_row ? 1 : 0;
+    const size_t num_public_inputs = circuit_constructor.public_inputs.size();
+    EXPECT_EQ(copy_cycles.nodes.size(),
+              (circuit_constructor.num_gates + num_zero_rows) * Flavor::NUM_WIRES + 2 * num_public_inputs);
+
+    // Within a cycle, nodes are ordered by row and then by wire, so a public input's cycle starts with its two copies
+    for (size_t i = 0; i < copy_cycles.size(); ++i) {
+        const auto cycle = copy_cycles[i];
+        for (size_t j = 1; j < cycle.size(); ++j) {
+            EXPECT_TRUE(cycle[j - 1].gate_index < cycle[j].gate_index ||
+                        (cycle[j - 1].gate_index == cycle[j].gate_index &&
+                         cycle[j - 1].wire_index < cycle[j].wire_index));
+        }
+    }
+    for (size_t i = 0; i < num_public_inputs; ++i) {
+        const auto cycle = copy_cycles[circuit_constructor.real_variable_index[circuit_constructor.public_inputs[i]]];
+        ASSERT_GE(cycle.size(), 2UL);
+        EXPECT_EQ(cycle[0].wire_index, 0U);
+        EXPECT_EQ(cycle[1].wire_index, 1U);
+        EXPECT_EQ(cycle[0].gate_index, static_cast<uint32_t>(i + num_zero_rows));
+        EXPECT_EQ(cycle[1].gate_index, static_cast<uint32_t>(i + num_zero_rows));
+    }
 }
 
 TEST_F(PermutationHelperTests, ComputePermutationMapping)
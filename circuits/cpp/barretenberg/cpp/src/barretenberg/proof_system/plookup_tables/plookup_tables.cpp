@@ -1,5 +1,6 @@
 #include "plookup_tables.hpp"
 #include "barretenberg/common/constexpr_utils.hpp"
+#include <mutex>
 
 namespace plookup {
 
@@ -7,7 +8,7 @@ using namespace barretenberg;
 
 namespace {
 static std::array<MultiTable, MultiTableId::NUM_MULTI_TABLES> MULTI_TABLES;
-static bool inited = false;
+static std::once_flag inited;
 
 void init_multi_tables()
 {
@@ -100,12 +101,14 @@ void init_multi_tables()
 }
 } // namespace
 
+void initialize_multi_tables()
+{
+    std::call_once(inited, init_multi_tables);
+}
+
 const MultiTable& create_table(const MultiTableId id)
 {
-    if (!inited) {
-        init_multi_tables();
-        inited = true;
-    }
+    initialize_multi_tables();
     return MULTI_TABLES[id];
 }
 
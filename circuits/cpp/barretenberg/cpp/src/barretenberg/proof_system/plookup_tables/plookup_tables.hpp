@@ -18,6 +18,12 @@
 
 namespace plookup {
 
+/**
+ * @brief Builds every multi-table, if that has not happened yet. Safe to call from several threads; create_table calls
+ * it on first use.
+ */
+void initialize_multi_tables();
+
 const MultiTable& create_table(const MultiTableId id);
 
 ReadData<barretenberg::fr> get_lookup_accumulators(const MultiTableId id,
@@ -1,5 +1,6 @@
 #include "polynomial_store.hpp"
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <cstddef>
 #include <map>
@@ -12,6 +13,9 @@ template <typename Fr> void PolynomialStore<Fr>::put(std::string const& key, Pol
 {
     // info("put ", key, ": ", value.hash());
     polynomial_map[key] = std::move(value);
+#ifndef __wasm__
+    spilled_map.erase(key);
+#endif
     // info("poly store put: ", key, " ", get_size_in_bytes() / (1024 * 1024), "MB");
 };
 
@@ -25,6 +29,11 @@ template <typename Fr> void PolynomialStore<Fr>::put(std::string const& key, Pol
 template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStore<Fr>::get(std::string const& key)
 {
     // info("poly store get: ", key);
+#ifndef __wasm__
+    if (spilled_map.contains(key)) {
+        restore(key);
+    }
+#endif
     // Take a shallow copy of the polynomial. Compiler will move the shallow copy to call site.
     auto p = polynomial_map.at(key).clone();
     // info("got ", key, ": ", p.hash());
@@ -38,10 +47,53 @@ template <typename Fr> barretenberg::Polynomial<Fr> PolynomialStore<Fr>::get(std
  */
 template <typename Fr> void PolynomialStore<Fr>::remove(std::string const& key)
 {
-    ASSERT(polynomial_map.contains(key));
+    ASSERT(contains(key));
     polynomial_map.erase(key);
+#ifndef __wasm__
+    spilled_map.erase(key);
+#endif
 };
 
+#ifndef __wasm__
+/**
+ * @brief Write the polynomial with the given key to a temporary file and drop it from memory. The file is deleted when
+ * the polynomial is restored or removed, or the store is destroyed.
+ *
+ * @param key
+ */
+template <typename Fr> void PolynomialStore<Fr>::spill(std::string const& key)
+{
+    auto const& polynomial = polynomial_map.at(key);
+    std::shared_ptr<FILE> file(std::tmpfile(), [](FILE* f) {
+        if (f != nullptr) {
+            std::fclose(f);
+        }
+    });
+    if (!file || std::fwrite(polynomial.data().get(), sizeof(Fr), polynomial.size(), file.get()) != polynomial.size()) {
+        throw_or_abort("Failed to spill polynomial: " + key);
+    }
+    spilled_map[key] = { file, polynomial.size() };
+    polynomial_map.erase(key);
+}
+
+/**
+ * @brief Read a spilled polynomial back into memory.
+ *
+ * @param key
+ */
+template <typename Fr> void PolynomialStore<Fr>::restore(std::string const& key)
+{
+    auto spilled = spilled_map.at(key);
+    Polynomial polynomial(spilled.size);
+    std::rewind(spilled.file.get());
+    if (std::fread(polynomial.data().get(), sizeof(Fr), spilled.size, spilled.file.get()) != spilled.size) {
+        throw_or_abort("Failed to restore spilled polynomial: " + key);
+    }
+    polynomial_map[key] = std::move(polynomial);
+    spilled_map.erase(key);
+}
+#endif
+
 /**
  * @brief Get the current size (bytes) of all polynomials in the PolynomialStore
  *
@@ -3,7 +3,9 @@
 #include "barretenberg/common/assert.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <cstddef>
+#include <cstdio>
 #include <map>
+#include <memory>
 #include <string>
 #include <unordered_map>
 
@@ -13,6 +15,13 @@ template <typename Fr> class PolynomialStore {
   private:
     using Polynomial = barretenberg::Polynomial<Fr>;
     std::unordered_map<std::string, Polynomial> polynomial_map;
+#ifndef __wasm__
+    struct SpilledPolynomial {
+        std::shared_ptr<FILE> file;
+        size_t size;
+    };
+    std::unordered_map<std::string, SpilledPolynomial> spilled_map;
+#endif
 
   public:
     /**
@@ -28,15 +37,32 @@ template <typename Fr> class PolynomialStore {
 
     void remove(std::string const& key);
 
+#ifndef __wasm__
+    /**
+     * Move a polynomial out of memory and into an anonymous temporary file, until it is restored. Its memory is freed
+     * once no other copies of the polynomial are left. A get() restores the polynomial by itself.
+     */
+    void spill(std::string const& key);
+
+    void restore(std::string const& key);
+
+    bool is_spilled(std::string const& key) const { return spilled_map.contains(key); }
+#endif
+
     size_t get_size_in_bytes() const;
 
     void print();
 
     // Basic map methods
+#ifndef __wasm__
+    bool contains(std::string const& key) { return polynomial_map.contains(key) || spilled_map.contains(key); };
+    size_t size() { return polynomial_map.size() + spilled_map.size(); };
+#else
     bool contains(std::string const& key) { return polynomial_map.contains(key); };
     size_t size() { return polynomial_map.size(); };
+#endif
 
-    // Allow for const range based for loop
+    // Allow for const range based for loop (over the polynomials in memory)
     typename std::unordered_map<std::string, Polynomial>::const_iterator begin() const
     {
         return polynomial_map.begin();
@@ -90,4 +90,47 @@ TEST(PolynomialStore, Remove)
     EXPECT_EQ(polynomial_store.get_size_in_bytes(), bytes_expected);
 }
 
+#ifndef __wasm__
+// Ensure that a spilled polynomial leaves memory, and comes back unchanged when restored or got
+TEST(PolynomialStore, SpillThenRestore)
+{
+    PolynomialStore<Fr> polynomial_store;
+    size_t size1 = 100;
+    size_t size2 = 500;
+    Polynomial poly1(size1);
+    Polynomial poly2(size2);
+    for (auto& coeff : poly1) {
+        coeff = Fr::random_element();
+    }
+    Polynomial poly1_copy(poly1);
+
+    polynomial_store.put("id_1", std::move(poly1));
+    polynomial_store.put("id_2", std::move(poly2));
+
+    polynomial_store.spill("id_1");
+
+    EXPECT_TRUE(polynomial_store.is_spilled("id_1"));
+    EXPECT_TRUE(polynomial_store.contains("id_1"));
+    EXPECT_EQ(polynomial_store.size(), 2UL);
+    EXPECT_EQ(polynomial_store.get_size_in_bytes(), sizeof(Fr) * size2);
+
+    polynomial_store.restore("id_1");
+
+    EXPECT_FALSE(polynomial_store.is_spilled("id_1"));
+    EXPECT_EQ(polynomial_store.get_size_in_bytes(), sizeof(Fr) * (size1 + size2));
+    EXPECT_EQ(poly1_copy, polynomial_store.get("id_1"));
+
+    polynomial_store.spill("id_1");
+
+    EXPECT_EQ(poly1_copy, polynomial_store.get("id_1"));
+    EXPECT_FALSE(polynomial_store.is_spilled("id_1"));
+
+    polynomial_store.spill("id_2");
+    polynomial_store.remove("id_2");
+
+    EXPECT_FALSE(polynomial_store.contains("id_2"));
+    EXPECT_EQ(polynomial_store.size(), 1UL);
+}
+#endif
+
 } // namespace proof_system
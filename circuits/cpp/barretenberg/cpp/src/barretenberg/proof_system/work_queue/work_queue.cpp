@@ -2,6 +2,7 @@
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
+#include <map>
 
 namespace proof_system::plonk {
 
@@ -201,24 +202,17 @@ void work_queue::add_to_queue(const work_item& item)
 
 void work_queue::process_queue()
 {
+    // The scalar multiplications all run against the same SRS; batch those of equal size so that each group shares a
+    // single pass of pippenger over the point table. Their scalars were captured when queued, so computing them ahead
+    // of the FFT work items is safe. Results are added to the transcript in queue order below.
+    std::vector<barretenberg::g1::affine_element> msm_results = compute_scalar_multiplications();
+    size_t msm_count = 0;
+
     for (const auto& item : work_item_queue) {
         switch (item.work_type) {
         // most expensive op
         case WorkType::SCALAR_MULTIPLICATION: {
-            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
-            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
-
-            ASSERT(msm_size <= key->reference_string->get_monomial_size());
-
-            barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
-
-            // Run pippenger multi-scalar multiplication.
-            auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
-            barretenberg::g1::affine_element result(barretenberg::scalar_multiplication::pippenger_unsafe<curve::BN254>(
-                item.mul_scalars.get(), srs_points, msm_size, runtime_state));
-
-            transcript->add_element(item.tag, result.to_buffer());
-
+            transcript->add_element(item.tag, msm_results[msm_count++].to_buffer());
             break;
         }
         // Commenting this out as per above.
@@ -248,18 +242,8 @@ void work_queue::process_queue()
         //     }
         //     break;
         // }
+        // Computed together once the monomial forms from any IFFTs are in place, below.
         case WorkType::FFT: {
-            using namespace barretenberg;
-            auto wire = key->polynomial_store.get(item.tag);
-            polynomial wire_fft(wire, 4 * key->circuit_size + 4);
-
-            wire_fft.coset_fft(key->large_domain);
-            for (size_t i = 0; i < 4; i++) {
-                wire_fft[4 * key->circuit_size + i] = wire_fft[i];
-            }
-
-            key->polynomial_store.put(item.tag + "_fft", std::move(wire_fft));
-
             break;
         }
         // 1/4 the cost of an fft (each fft has 1/4 the number of elements)
@@ -279,9 +263,92 @@ void work_queue::process_queue()
         }
         }
     }
+    compute_coset_ffts();
     work_item_queue = std::vector<work_item>();
 }
 
+/**
+ * @brief Compute the coset FFTs of all of the queued FFT work items in one batched transform over the large domain (see
+ * batch_coset_fft), and put them into the store.
+ */
+void work_queue::compute_coset_ffts()
+{
+    using namespace barretenberg;
+    std::vector<std::string> tags;
+    std::vector<polynomial> wire_ffts;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == WorkType::FFT) {
+            tags.push_back(item.tag);
+            wire_ffts.emplace_back(key->polynomial_store.get(item.tag), 4 * key->circuit_size + 4);
+        }
+    }
+    if (wire_ffts.empty()) {
+        return;
+    }
+
+    std::vector<fr*> coefficients;
+    for (auto& wire_fft : wire_ffts) {
+        coefficients.push_back(wire_fft.data().get());
+    }
+    polynomial_arithmetic::batch_coset_fft(coefficients, key->large_domain);
+
+    for (size_t j = 0; j < wire_ffts.size(); ++j) {
+        for (size_t i = 0; i < 4; i++) {
+            wire_ffts[j][4 * key->circuit_size + i] = wire_ffts[j][i];
+        }
+        key->polynomial_store.put(tags[j] + "_fft", std::move(wire_ffts[j]));
+    }
+}
+
+std::vector<barretenberg::g1::affine_element> work_queue::compute_scalar_multiplications() const
+{
+    // Group the queued scalar multiplications by size, remembering each one's position in the queue
+    std::map<size_t, std::vector<size_t>> msm_indices_by_size;
+    std::vector<fr*> msm_scalars;
+    for (const auto& item : work_item_queue) {
+        if (item.work_type == WorkType::SCALAR_MULTIPLICATION) {
+            // Note: work_item.constant is an Fr type (see SMALL_FFT), but here it is interpreted simply as a size_t
+            auto msm_size = static_cast<size_t>(static_cast<uint256_t>(item.constant));
+            ASSERT(msm_size <= key->reference_string->get_monomial_size());
+            msm_indices_by_size[msm_size].push_back(msm_scalars.size());
+            msm_scalars.push_back(item.mul_scalars.get());
+        }
+    }
+
+    std::vector<barretenberg::g1::affine_element> results(msm_scalars.size());
+    if (msm_scalars.empty()) {
+        return results;
+    }
+
+    barretenberg::g1::affine_element* srs_points = key->reference_string->get_monomial_points();
+    const auto* fixed_base_table = key->reference_string->get_fixed_base_table();
+    for (const auto& [msm_size, indices] : msm_indices_by_size) {
+        auto runtime_state = barretenberg::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
+
+        // If the crs carries a fixed-base table, each multiplication skips the per-round doublings instead.
+        if (fixed_base_table != nullptr) {
+            for (const auto index : indices) {
+                results[index] = barretenberg::scalar_multiplication::pippenger_fixed_base_unsafe<curve::BN254>(
+                    msm_scalars[index], *fixed_base_table, msm_size, runtime_state);
+            }
+            continue;
+        }
+
+        std::vector<fr*> batch_scalars;
+        for (const auto index : indices) {
+            batch_scalars.push_back(msm_scalars[index]);
+        }
+
+        // Run a batch of pippenger multi-scalar multiplications.
+        auto batch_results = barretenberg::scalar_multiplication::pippenger_batch_unsafe<curve::BN254>(
+            batch_scalars, srs_points, msm_size, runtime_state);
+        for (size_t i = 0; i < indices.size(); ++i) {
+            results[indices[i]] = barretenberg::g1::affine_element(batch_results[i]);
+        }
+    }
+    return results;
+}
+
 std::vector<work_queue::work_item> work_queue::get_queue() const
 {
     return work_item_queue;
@@ -64,6 +64,9 @@ class work_queue {
     std::vector<work_item> get_queue() const;
 
   private:
+    std::vector<barretenberg::g1::affine_element> compute_scalar_multiplications() const;
+    void compute_coset_ffts();
+
     proving_key* key;
     transcript::StandardTranscript* transcript;
     std::vector<work_item> work_item_queue;
@@ -4,6 +4,7 @@
 #include "barretenberg/ecc/curves/bn254/g1.hpp"
 #include "barretenberg/ecc/curves/bn254/g2.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include <cstddef>
 
 namespace barretenberg::pairing {
@@ -25,6 +26,13 @@ template <typename Curve> class ProverCrs {
      */
     virtual typename Curve::AffineElement* get_monomial_points() = 0;
     virtual size_t get_monomial_size() const = 0;
+    /**
+     * @brief Returns the precomputed fixed-base table for the monomial points, if the crs was loaded with one.
+     */
+    virtual scalar_multiplication::fixed_base_point_table<Curve> const* get_fixed_base_table() const
+    {
+        return nullptr;
+    }
 };
 
 template <typename Curve> class VerifierCrs {
@@ -31,9 +31,13 @@ FileVerifierCrs<curve::Grumpkin>::FileVerifierCrs(std::string const& path, const
     : num_points(num_points)
 {
     using Curve = curve::Grumpkin;
-    monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
-    srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
-    scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    monomials_ = srs::IO<Curve>::map_preprocessed_transcript(
+        num_points, scalar_multiplication::point_table_size(num_points), path);
+    if (!monomials_) {
+        monomials_ = scalar_multiplication::point_table_alloc<Curve::AffineElement>(num_points);
+        srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
+    }
     first_g1 = monomials_[0];
 };
 
@@ -47,17 +51,26 @@ size_t FileVerifierCrs<curve::Grumpkin>::get_monomial_size() const
     return num_points;
 }
 
+template <typename Curve> void write_preprocessed_transcript(std::string const& path, size_t num_points)
+{
+    auto point_table = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+    srs::IO<Curve>::read_transcript_g1(point_table.get(), num_points, path);
+    scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.get(), point_table.get(), num_points);
+    srs::IO<Curve>::write_preprocessed_transcript(point_table.get(), num_points, path);
+}
+
 template <typename Curve>
-FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree)
+FileCrsFactory<Curve>::FileCrsFactory(std::string path, size_t initial_degree, bool precompute_fixed_base)
     : path_(std::move(path))
     , degree_(initial_degree)
+    , precompute_fixed_base_(precompute_fixed_base)
 {}
 
 template <typename Curve>
 std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
     if (degree != degree_ || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, precompute_fixed_base_);
         degree_ = degree;
     }
     return prover_crs_;
@@ -73,6 +86,9 @@ std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> FileCrsFactory
     return verifier_crs_;
 }
 
+template void write_preprocessed_transcript<curve::BN254>(std::string const& path, size_t num_points);
+template void write_preprocessed_transcript<curve::Grumpkin>(std::string const& path, size_t num_points);
+
 template class FileProverCrs<curve::BN254>;
 template class FileProverCrs<curve::Grumpkin>;
 template class FileCrsFactory<curve::BN254>;
@@ -12,10 +12,12 @@ namespace barretenberg::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ * If `precompute_fixed_base` is set, prover crs' are loaded with a fixed-base point table (see
+ * `scalar_multiplication::fixed_base_point_table`), trading memory for faster commitments.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
-    FileCrsFactory(std::string path, size_t initial_degree = 0);
+    FileCrsFactory(std::string path, size_t initial_degree = 0, bool precompute_fixed_base = false);
     FileCrsFactory(FileCrsFactory&& other) = default;
 
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> get_prover_crs(size_t degree) override;
@@ -25,28 +27,56 @@ template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   private:
     std::string path_;
     size_t degree_;
+    bool precompute_fixed_base_;
     std::shared_ptr<barretenberg::srs::factories::ProverCrs<Curve>> prover_crs_;
     std::shared_ptr<barretenberg::srs::factories::VerifierCrs<Curve>> verifier_crs_;
 };
 
+/**
+ * Reads `num_points` points from the transcripts in `path` and writes their pippenger point table to the path's
+ * preprocessed transcript, which FileProverCrs will then memory-map instead of reading the transcripts.
+ */
+template <typename Curve> void write_preprocessed_transcript(std::string const& path, size_t num_points);
+
 template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
   public:
-    FileProverCrs(const size_t num_points, std::string const& path)
+    FileProverCrs(const size_t num_points, std::string const& path, const bool precompute_fixed_base = false)
         : num_points(num_points)
     {
+        if (precompute_fixed_base) {
+            fixed_base_table_ = scalar_multiplication::alloc_fixed_base_point_table<Curve>(num_points);
+            srs::IO<Curve>::read_transcript_g1(fixed_base_table_.get_point_table(), num_points, path);
+            scalar_multiplication::generate_fixed_base_point_table<Curve>(fixed_base_table_);
+            return;
+        }
+        // Use the preprocessed point table if there is one, sharing its pages with any other process using it.
+        monomials_ = srs::IO<Curve>::map_preprocessed_transcript(
+            num_points, scalar_multiplication::point_table_size(num_points), path);
+        if (monomials_) {
+            return;
+        }
         monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
 
         srs::IO<Curve>::read_transcript_g1(monomials_.get(), num_points, path);
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
     };
 
-    typename Curve::AffineElement* get_monomial_points() { return monomials_.get(); }
+    typename Curve::AffineElement* get_monomial_points()
+    {
+        return fixed_base_table_.points ? fixed_base_table_.get_point_table() : monomials_.get();
+    }
 
     size_t get_monomial_size() const { return num_points; }
 
+    scalar_multiplication::fixed_base_point_table<Curve> const* get_fixed_base_table() const override
+    {
+        return fixed_base_table_.points ? &fixed_base_table_ : nullptr;
+    }
+
   private:
     size_t num_points;
     std::shared_ptr<typename Curve::AffineElement[]> monomials_;
+    scalar_multiplication::fixed_base_point_table<Curve> fixed_base_table_;
 };
 
 template <typename Curve> class FileVerifierCrs : public VerifierCrs<Curve> {
@@ -86,6 +116,9 @@ template <> class FileVerifierCrs<curve::Grumpkin> : public VerifierCrs<curve::G
     std::shared_ptr<Curve::AffineElement[]> monomials_;
 };
 
+extern template void write_preprocessed_transcript<curve::BN254>(std::string const& path, size_t num_points);
+extern template void write_preprocessed_transcript<curve::Grumpkin>(std::string const& path, size_t num_points);
+
 extern template class FileProverCrs<curve::BN254>;
 extern template class FileProverCrs<curve::Grumpkin>;
 
@@ -18,9 +18,9 @@ void init_crs_factory(std::vector<g1::affine_element> const& points, g2::affine_
 }
 
 // Initialises crs from a file path this we use in the entire codebase
-void init_crs_factory(std::string crs_path)
+void init_crs_factory(std::string crs_path, bool precompute_fixed_base)
 {
-    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path);
+    crs_factory = std::make_shared<factories::FileCrsFactory<curve::BN254>>(crs_path, 0, precompute_fixed_base);
 }
 
 void init_grumpkin_crs_factory(std::string crs_path)
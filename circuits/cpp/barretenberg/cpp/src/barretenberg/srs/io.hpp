@@ -1,11 +1,20 @@
 #pragma once
 #include "../ecc/curves/bn254/bn254.hpp"
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
+#include <chrono>
 #include <concepts>
 #include <cstdint>
+#include <cstdio>
+#include <cstring>
 #include <fstream>
+#include <memory>
 #include <string>
 #include <sys/stat.h>
+#if defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
 
 namespace barretenberg::srs {
 /**
@@ -45,6 +54,28 @@ struct Manifest {
     uint32_t start_from;
 };
 
+/**
+ * @brief The header of a preprocessed prover SRS file
+ *
+ * @details Unlike a transcript, a preprocessed file is laid out exactly as pippenger wants it in memory, so it can be
+ * memory-mapped and used without any copying or conversion:
+ *
+ * 00   | PreprocessedManifest      | 64 bytes, native endian
+ * 40   | pippenger point table     | num_table_points affine elements in native-endian Montgomery form: each SRS point
+ *      |                           | followed by its endomorphism, then padding points covering pippenger's prefetches
+ *
+ * It is only portable between hosts with the same endianness and field representation, which the header records.
+ */
+struct PreprocessedManifest {
+    uint64_t magic;
+    uint32_t version;
+    uint32_t point_size;
+    uint64_t num_points;
+    uint64_t num_table_points;
+    uint64_t modulus[4];
+};
+static_assert(sizeof(PreprocessedManifest) == 64);
+
 // Detect whether a curve has a G2AffineElement defined
 template <typename Curve> concept HasG2 = requires
 {
@@ -370,6 +401,103 @@ template <typename Curve> class IO {
         read_transcript_g1(monomials, degree, path);
     }
 
+    static std::string get_preprocessed_transcript_path(std::string const& dir)
+    {
+        return format(dir, "/monomial/pippenger_table.dat");
+    };
+
+    static constexpr uint64_t PREPROCESSED_MAGIC = 0x4c42545050504242; // "BBPPPTBL"
+    static constexpr uint32_t PREPROCESSED_VERSION = 1;
+    // Enough for the pippenger prefetch overflow of up to 1024 threads.
+    static constexpr size_t PREPROCESSED_PADDING_POINTS = 16 * 1024;
+
+    static PreprocessedManifest get_preprocessed_manifest(size_t num_points)
+    {
+        const uint256_t modulus = Fq::modulus;
+        return { PREPROCESSED_MAGIC,
+                 PREPROCESSED_VERSION,
+                 sizeof(AffineElement),
+                 num_points,
+                 2 * num_points + PREPROCESSED_PADDING_POINTS,
+                 { modulus.data[0], modulus.data[1], modulus.data[2], modulus.data[3] } };
+    }
+
+    /**
+     * @brief Writes a pippenger point table (see `generate_pippenger_point_table`) of `num_points` SRS points to the
+     * preprocessed transcript in `dir`. The file is written under a temporary name and renamed into place, so
+     * processes mapping it concurrently never see a partial file.
+     */
+    static void write_preprocessed_transcript(AffineElement const* point_table, size_t num_points, std::string const& dir)
+    {
+        const auto manifest = get_preprocessed_manifest(num_points);
+        const std::string path = get_preprocessed_transcript_path(dir);
+        const auto nonce = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        const std::string tmp_path = format(path, ".tmp.", std::to_string(nonce));
+        {
+            std::ofstream file(tmp_path, std::ofstream::binary | std::ofstream::trunc);
+            file.write((char const*)&manifest, sizeof(manifest));
+            file.write((char const*)point_table, (std::streamsize)(2 * num_points * sizeof(AffineElement)));
+            const std::vector<char> padding(PREPROCESSED_PADDING_POINTS * sizeof(AffineElement), 0);
+            file.write(padding.data(), (std::streamsize)padding.size());
+            if (!file) {
+                throw_or_abort(format("Failed to write preprocessed transcript to ", tmp_path, "."));
+            }
+        }
+        if (std::rename(tmp_path.c_str(), path.c_str()) != 0) {
+            std::remove(tmp_path.c_str());
+            throw_or_abort(format("Failed to move preprocessed transcript into ", path, "."));
+        }
+    }
+
+    /**
+     * @brief Maps the preprocessed transcript in `dir` read-only, if there is one that can serve a pippenger point
+     * table of `degree` points spanning `table_size` elements (including prefetch overflow).
+     *
+     * @details Mapped pages are shared with every other process mapping the same file, and are served from the page
+     * cache once any process has loaded them. Returns nullptr if there is no usable file, in which case callers
+     * should fall back to reading the transcripts. The returned table must not be written to.
+     */
+    static std::shared_ptr<AffineElement[]> map_preprocessed_transcript(size_t degree,
+                                                                         size_t table_size,
+                                                                         std::string const& dir)
+    {
+#if defined(__linux__) || defined(__APPLE__)
+        const std::string path = get_preprocessed_transcript_path(dir);
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        struct stat st;
+        PreprocessedManifest manifest;
+        const bool header_read = fstat(fd, &st) == 0 &&
+                                 pread(fd, &manifest, sizeof(manifest), 0) == (ssize_t)sizeof(manifest);
+        const auto expected = get_preprocessed_manifest(manifest.num_points);
+        const size_t file_size = sizeof(manifest) + manifest.num_table_points * sizeof(AffineElement);
+        if (!header_read || std::memcmp(&manifest, &expected, sizeof(manifest)) != 0 ||
+            (size_t)st.st_size < file_size || degree > manifest.num_points ||
+            table_size > manifest.num_table_points) {
+            close(fd);
+            return nullptr;
+        }
+        void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+        // The mapping holds its own reference to the file.
+        close(fd);
+        if (mapping == MAP_FAILED) {
+            return nullptr;
+        }
+        madvise(mapping, file_size, MADV_WILLNEED);
+        auto* table = reinterpret_cast<AffineElement*>(static_cast<char*>(mapping) + sizeof(manifest));
+        return std::shared_ptr<AffineElement[]>(table, [mapping, file_size](AffineElement*) {
+            munmap(mapping, file_size);
+        });
+#else
+        static_cast<void>(degree);
+        static_cast<void>(table_size);
+        static_cast<void>(dir);
+        return nullptr;
+#endif
+    }
+
     // This function is a vestige of the Lagrange form transcript work, and it is not used anywhere.
     static void write_transcript(AffineElement const* g1_x,
                                  auto const* g2_x,
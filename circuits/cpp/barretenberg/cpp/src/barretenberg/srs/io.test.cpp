@@ -1,7 +1,9 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "factories/file_crs_factory.hpp"
 #include "io.hpp"
+#include <filesystem>
 #include <gtest/gtest.h>
 
 using namespace barretenberg;
@@ -30,3 +32,27 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+TEST(io, preprocessed_transcript_is_mapped_by_prover_crs)
+{
+    constexpr size_t num_points = 1024;
+    const auto dir = std::filesystem::temp_directory_path() / "bb_preprocessed_srs_test";
+    std::filesystem::create_directories(dir / "monomial");
+
+    // Generate the table from the real transcripts, then load it from a directory with no transcripts in it.
+    auto point_table = scalar_multiplication::point_table_alloc<g1::affine_element>(num_points);
+    srs::IO<curve::BN254>::read_transcript_g1(point_table.get(), num_points, "../srs_db/ignition");
+    scalar_multiplication::generate_pippenger_point_table<curve::BN254>(
+        point_table.get(), point_table.get(), num_points);
+    srs::IO<curve::BN254>::write_preprocessed_transcript(point_table.get(), num_points, dir);
+    srs::factories::FileProverCrs<curve::BN254> mapped_crs(num_points / 2, dir);
+    srs::factories::FileProverCrs<curve::BN254> read_crs(num_points / 2, "../srs_db/ignition");
+
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(mapped_crs.get_monomial_points()[i], read_crs.get_monomial_points()[i]);
+    }
+
+    // A crs larger than the preprocessed table falls back to reading transcripts, which are missing here.
+    EXPECT_ANY_THROW(srs::factories::FileProverCrs<curve::BN254>(num_points + 1, dir));
+    std::filesystem::remove_all(dir);
+}
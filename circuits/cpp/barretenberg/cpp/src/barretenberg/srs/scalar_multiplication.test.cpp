@@ -975,6 +975,92 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerUnsafeShortInputs)
     EXPECT_EQ(result == expected, true);
 }
 
+TYPED_TEST(ScalarMultiplicationTests, PippengerBatch)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    // not a power of two, so that the leftover points are batched too
+    constexpr size_t num_points = 3000;
+    constexpr size_t num_msms = 3;
+
+    auto points = barretenberg::scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+    std::vector<std::vector<Fr>> scalars(num_msms, std::vector<Fr>(num_points));
+    std::vector<Fr*> scalar_pointers;
+
+    for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+        points[i] = AffineElement(Element::random_element());
+    }
+    for (auto& msm_scalars : scalars) {
+        for (auto& scalar : msm_scalars) {
+            scalar = Fr::random_element();
+        }
+        scalar_pointers.push_back(&msm_scalars[0]);
+    }
+    // exercise the skew handling with an even scalar in one of the msms
+    scalars[1][0] = Fr(2);
+
+    std::vector<Element> expected(num_msms);
+    for (size_t k = 0; k < num_msms; ++k) {
+        expected[k].self_set_infinity();
+        for (std::ptrdiff_t i = 0; i < (std::ptrdiff_t)num_points; ++i) {
+            Element temp = points[i] * scalars[k][static_cast<size_t>(i)];
+            expected[k] += temp;
+        }
+        expected[k] = expected[k].normalize();
+    }
+
+    barretenberg::scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    std::vector<Element> results = barretenberg::scalar_multiplication::pippenger_batch<Curve>(
+        scalar_pointers, points.get(), num_points, state);
+
+    ASSERT_EQ(results.size(), num_msms);
+    for (size_t k = 0; k < num_msms; ++k) {
+        EXPECT_EQ(results[k].normalize(), expected[k]);
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerFixedBase)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 3000;
+
+    auto table = barretenberg::scalar_multiplication::alloc_fixed_base_point_table<Curve>(num_points);
+    AffineElement* points = table.get_point_table();
+    std::vector<AffineElement> srs_points(num_points);
+    std::vector<Fr> scalars(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        srs_points[i] = AffineElement(Element::random_element());
+        points[i] = srs_points[i];
+        scalars[i] = Fr::random_element();
+    }
+    barretenberg::scalar_multiplication::generate_fixed_base_point_table<Curve>(table);
+    barretenberg::scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+
+    // A full-size msm uses the scaled tables, a shorter one falls back to the variable-base algorithm
+    for (const size_t msm_size : { num_points, num_points / 3 }) {
+        Element expected;
+        expected.self_set_infinity();
+        for (size_t i = 0; i < msm_size; ++i) {
+            Element temp = srs_points[i] * scalars[i];
+            expected += temp;
+        }
+        expected = expected.normalize();
+
+        Element result = barretenberg::scalar_multiplication::pippenger_fixed_base<Curve>(
+            &scalars[0], table, msm_size, state);
+        EXPECT_EQ(result.normalize(), expected);
+    }
+}
+
 TYPED_TEST(ScalarMultiplicationTests, PippengerOne)
 {
     using Curve = TypeParam;
@@ -0,0 +1,284 @@
+#include "file_store.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+namespace {
+constexpr uint64_t FILE_STORE_MAGIC = 0x45524f5453454c46; // "FLESTORE"
+constexpr uint32_t FILE_STORE_VERSION = 1;
+
+// FNV-1a. Most keys are field elements that are hashes already, so this mostly just folds them into 64 bits.
+uint64_t hash_key(std::string const& key)
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    for (const char c : key) {
+        hash = (hash ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+    }
+    return hash ^ (hash >> 32);
+}
+
+size_t round_up_power_2(size_t n)
+{
+    const size_t msb = numeric::get_msb(n);
+    return (n == (1ULL << msb)) ? n : (1ULL << (msb + 1));
+}
+} // namespace
+
+FileStore::FileStore(std::string path, size_t cache_pages, size_t initial_slots)
+    : path_(std::move(path))
+    , cache_pages_(std::max(cache_pages, size_t(1)))
+{
+    open_file(true, initial_slots);
+}
+
+FileStore::~FileStore()
+{
+    file_.close();
+}
+
+void FileStore::open_file(bool create, size_t initial_slots)
+{
+    file_.open(path_, std::ios::in | std::ios::out | std::ios::binary);
+    if (!file_.is_open()) {
+        if (!create) {
+            throw_or_abort("FileStore: failed to open " + path_);
+        }
+        // Create the file, then reopen it for reading and writing.
+        std::ofstream(path_, std::ios::out | std::ios::binary).close();
+        file_.open(path_, std::ios::in | std::ios::out | std::ios::binary);
+        if (!file_.is_open()) {
+            throw_or_abort("FileStore: failed to create " + path_);
+        }
+        header_ = { FILE_STORE_MAGIC,
+                    FILE_STORE_VERSION,
+                    0,
+                    round_up_power_2(std::max(initial_slots, RECORDS_PER_PAGE)),
+                    0,
+                    0 };
+        write_header();
+        return;
+    }
+
+    file_.seekg(0);
+    file_.read((char*)&header_, sizeof(header_));
+    if (!file_ || header_.magic != FILE_STORE_MAGIC || header_.version != FILE_STORE_VERSION) {
+        throw_or_abort("FileStore: " + path_ + " is not a valid store.");
+    }
+    if (header_.committing != 0) {
+        throw_or_abort("FileStore: " + path_ + " was interrupted during a commit.");
+    }
+}
+
+void FileStore::write_header()
+{
+    file_.seekp(0);
+    file_.write((char const*)&header_, sizeof(header_));
+    file_.flush();
+}
+
+FileStore::Page& FileStore::get_page(uint64_t page_index)
+{
+    auto it = page_index_.find(page_index);
+    if (it != page_index_.end()) {
+        pages_.splice(pages_.begin(), pages_, it->second);
+        return pages_.front();
+    }
+
+    if (pages_.size() >= cache_pages_) {
+        auto& victim = pages_.back();
+        if (victim.dirty) {
+            file_.seekp((std::streamoff)(victim.index * PAGE_SIZE));
+            file_.write((char const*)victim.data.data(), PAGE_SIZE);
+        }
+        page_index_.erase(victim.index);
+        pages_.pop_back();
+    }
+
+    pages_.push_front({ page_index, false, {} });
+    auto& page = pages_.front();
+    page_index_[page_index] = pages_.begin();
+    file_.seekg((std::streamoff)(page_index * PAGE_SIZE));
+    file_.read((char*)page.data.data(), PAGE_SIZE);
+    if (!file_) {
+        // Pages past the end of the file have never been written, so hold only empty records.
+        const auto num_read = static_cast<size_t>(file_.gcount());
+        std::fill(page.data.begin() + (std::ptrdiff_t)num_read, page.data.end(), 0);
+        file_.clear();
+    }
+    return page;
+}
+
+FileStore::Record* FileStore::get_record(uint64_t slot, bool for_write)
+{
+    auto& page = get_page(1 + slot / RECORDS_PER_PAGE);
+    page.dirty |= for_write;
+    return reinterpret_cast<Record*>(page.data.data() + (slot % RECORDS_PER_PAGE) * RECORD_SIZE);
+}
+
+uint64_t FileStore::find_slot(std::string const& key, bool& found)
+{
+    const uint64_t mask = header_.num_slots - 1;
+    const uint64_t start = hash_key(key) & mask;
+    uint64_t first_tombstone = header_.num_slots;
+    found = false;
+    for (uint64_t i = 0; i < header_.num_slots; ++i) {
+        const uint64_t slot = (start + i) & mask;
+        const auto* record = get_record(slot, false);
+        if (record->state == EMPTY) {
+            return first_tombstone < header_.num_slots ? first_tombstone : slot;
+        }
+        if (record->state == TOMBSTONE) {
+            first_tombstone = std::min(first_tombstone, slot);
+        } else if (record->key_size == key.size() && std::memcmp(record->key, key.data(), key.size()) == 0) {
+            found = true;
+            return slot;
+        }
+    }
+    return first_tombstone;
+}
+
+bool FileStore::put(std::string const& key, std::vector<uint8_t> const& value)
+{
+    if (key.size() > MAX_KEY_SIZE || value.size() > MAX_VALUE_SIZE) {
+        throw_or_abort("FileStore: key or value is too large for a record.");
+    }
+    puts_[key] = to_string(value);
+    deletes_.erase(key);
+    return true;
+}
+
+bool FileStore::del(std::vector<uint8_t> const& key)
+{
+    auto key_str = to_string(key);
+    puts_.erase(key_str);
+    deletes_.insert(key_str);
+    return true;
+}
+
+bool FileStore::get(std::string const& key, std::vector<uint8_t>& value)
+{
+    if (deletes_.find(key) != deletes_.end()) {
+        return false;
+    }
+    auto it = puts_.find(key);
+    if (it != puts_.end()) {
+        value = std::vector<uint8_t>(it->second.begin(), it->second.end());
+        return true;
+    }
+    if (key.size() > MAX_KEY_SIZE) {
+        return false;
+    }
+    bool found = false;
+    const uint64_t slot = find_slot(key, found);
+    if (!found) {
+        return false;
+    }
+    const auto* record = get_record(slot, false);
+    value = std::vector<uint8_t>(record->value, record->value + record->value_size);
+    return true;
+}
+
+void FileStore::insert_committed(std::string const& key, std::string const& value)
+{
+    bool found = false;
+    const uint64_t slot = find_slot(key, found);
+    auto* record = get_record(slot, true);
+    if (!found) {
+        header_.num_tombstones -= record->state == TOMBSTONE ? 1 : 0;
+        header_.num_entries++;
+    }
+    std::memset(record, 0, RECORD_SIZE);
+    record->state = USED;
+    record->key_size = static_cast<uint8_t>(key.size());
+    record->value_size = static_cast<uint8_t>(value.size());
+    std::memcpy(record->key, key.data(), key.size());
+    std::memcpy(record->value, value.data(), value.size());
+}
+
+void FileStore::erase_committed(std::string const& key)
+{
+    bool found = false;
+    const uint64_t slot = find_slot(key, found);
+    if (found) {
+        get_record(slot, true)->state = TOMBSTONE;
+        header_.num_entries--;
+        header_.num_tombstones++;
+    }
+}
+
+void FileStore::flush()
+{
+    std::vector<Page*> dirty_pages;
+    for (auto& page : pages_) {
+        if (page.dirty) {
+            dirty_pages.push_back(&page);
+        }
+    }
+    // Write back in file order, so the writes are as sequential as the table allows.
+    std::sort(dirty_pages.begin(), dirty_pages.end(), [](Page* a, Page* b) { return a->index < b->index; });
+    for (auto* page : dirty_pages) {
+        file_.seekp((std::streamoff)(page->index * PAGE_SIZE));
+        file_.write((char const*)page->data.data(), PAGE_SIZE);
+        page->dirty = false;
+    }
+    file_.flush();
+}
+
+void FileStore::grow()
+{
+    flush();
+    const std::string tmp_path = path_ + ".grow";
+    std::remove(tmp_path.c_str());
+    {
+        FileStore grown(tmp_path, cache_pages_, header_.num_slots * 2);
+        for (uint64_t slot = 0; slot < header_.num_slots; ++slot) {
+            const auto* record = get_record(slot, false);
+            if (record->state == USED) {
+                grown.insert_committed(std::string((char const*)record->key, record->key_size),
+                                       std::string((char const*)record->value, record->value_size));
+            }
+        }
+        grown.flush();
+        grown.write_header();
+    }
+    file_.close();
+    pages_.clear();
+    page_index_.clear();
+    if (std::rename(tmp_path.c_str(), path_.c_str()) != 0) {
+        throw_or_abort("FileStore: failed to replace " + path_ + " with its grown table.");
+    }
+    open_file(false, 0);
+}
+
+void FileStore::commit()
+{
+    // Keep the table at most half full (counting tombstones, which lengthen probe sequences just the same).
+    while ((header_.num_entries + header_.num_tombstones + puts_.size()) * 2 > header_.num_slots) {
+        grow();
+    }
+
+    header_.committing = 1;
+    write_header();
+    for (auto const& key : deletes_) {
+        erase_committed(key);
+    }
+    for (auto const& [key, value] : puts_) {
+        insert_committed(key, value);
+    }
+    flush();
+    header_.committing = 0;
+    write_header();
+
+    puts_.clear();
+    deletes_.clear();
+}
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
@@ -0,0 +1,134 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <map>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace proof_system::plonk {
+namespace stdlib {
+namespace merkle_tree {
+
+/**
+ * A persistent key-value store for MerkleTree, with the same interface and commit/rollback semantics as MemoryStore.
+ *
+ * Entries live in an on-disk open-addressing hash table of fixed-width 128 byte records (see `Record`), so a lookup
+ * touches a single page of the file in the common case. Pages are read through an LRU page cache of bounded size, so
+ * memory use is independent of the size of the tree. The nodes near the root are on every hash path, so their pages
+ * stay cached while the leaves' pages cycle through.
+ *
+ * As with MemoryStore, puts and deletes are buffered until `commit`, which applies them to the table and writes back
+ * all dirty pages in file order in one pass. The table doubles in size (rewriting the file) when it gets half full.
+ *
+ * The file header records whether a commit is in progress. A store that was interrupted mid-commit cannot be
+ * reopened, as its table may be partially written.
+ */
+class FileStore {
+  public:
+    static constexpr size_t PAGE_SIZE = 4096;
+    static constexpr size_t RECORD_SIZE = 128;
+    static constexpr size_t RECORDS_PER_PAGE = PAGE_SIZE / RECORD_SIZE;
+    static constexpr size_t MAX_KEY_SIZE = 48;
+    static constexpr size_t MAX_VALUE_SIZE = 72;
+    static constexpr size_t DEFAULT_CACHE_PAGES = 4096;
+    static constexpr size_t DEFAULT_INITIAL_SLOTS = 1024;
+
+    /**
+     * @brief Opens the store at `path`, creating it if it does not exist.
+     *
+     * @param cache_pages the maximum number of pages (of PAGE_SIZE bytes) held in memory
+     * @param initial_slots the number of records a newly created table has room for, rounded up to a power of two
+     */
+    FileStore(std::string path, size_t cache_pages = DEFAULT_CACHE_PAGES, size_t initial_slots = DEFAULT_INITIAL_SLOTS);
+    FileStore(FileStore const& rhs) = delete;
+    FileStore(FileStore&& rhs) = delete;
+    FileStore& operator=(FileStore const& rhs) = delete;
+    FileStore& operator=(FileStore&& rhs) = delete;
+    ~FileStore();
+
+    bool put(std::vector<uint8_t> const& key, std::vector<uint8_t> const& value)
+    {
+        return put(to_string(key), value);
+    }
+
+    bool put(std::string const& key, std::vector<uint8_t> const& value);
+
+    bool del(std::vector<uint8_t> const& key);
+
+    bool get(std::vector<uint8_t> const& key, std::vector<uint8_t>& value) { return get(to_string(key), value); }
+
+    bool get(std::string const& key, std::vector<uint8_t>& value);
+
+    void commit();
+
+    void rollback()
+    {
+        puts_.clear();
+        deletes_.clear();
+    }
+
+    // The number of committed entries.
+    size_t size() const { return header_.num_entries; }
+
+  private:
+    struct Header {
+        uint64_t magic;
+        uint32_t version;
+        uint32_t committing;
+        uint64_t num_slots;
+        uint64_t num_entries;
+        uint64_t num_tombstones;
+    };
+
+    enum RecordState : uint8_t { EMPTY = 0, USED = 1, TOMBSTONE = 2 };
+
+    // The on-disk layout of one hash table slot.
+    struct Record {
+        uint8_t state;
+        uint8_t key_size;
+        uint8_t value_size;
+        uint8_t padding[5];
+        uint8_t key[MAX_KEY_SIZE];
+        uint8_t value[MAX_VALUE_SIZE];
+    };
+    static_assert(sizeof(Record) == RECORD_SIZE);
+
+    struct Page {
+        uint64_t index;
+        bool dirty;
+        std::array<uint8_t, PAGE_SIZE> data;
+    };
+
+    std::string to_string(std::vector<uint8_t> const& input) { return std::string((char*)input.data(), input.size()); }
+
+    void open_file(bool create, size_t initial_slots);
+    void write_header();
+    Page& get_page(uint64_t page_index);
+    Record* get_record(uint64_t slot, bool for_write);
+    // Returns the slot holding `key`, or the first free slot of its probe sequence if it is absent.
+    uint64_t find_slot(std::string const& key, bool& found);
+    void insert_committed(std::string const& key, std::string const& value);
+    void erase_committed(std::string const& key);
+    void flush();
+    void grow();
+
+    std::string path_;
+    size_t cache_pages_;
+    std::fstream file_;
+    Header header_;
+
+    // Most recently used pages first.
+    std::list<Page> pages_;
+    std::unordered_map<uint64_t, std::list<Page>::iterator> page_index_;
+
+    std::map<std::string, std::string> puts_;
+    std::set<std::string> deletes_;
+};
+
+} // namespace merkle_tree
+} // namespace stdlib
+} // namespace proof_system::plonk
@@ -0,0 +1,102 @@
+#include "file_store.hpp"
+#include "barretenberg/common/test.hpp"
+#include "memory_store.hpp"
+#include "memory_tree.hpp"
+#include "merkle_tree.hpp"
+#include <filesystem>
+
+namespace proof_system::test_stdlib_merkle_tree {
+
+using namespace proof_system::plonk::stdlib::merkle_tree;
+
+namespace {
+std::string temp_store_path(std::string const& name)
+{
+    auto path = (std::filesystem::temp_directory_path() / name).string();
+    std::filesystem::remove(path);
+    return path;
+}
+} // namespace
+
+TEST(stdlib_merkle_tree_file_store, put_get_del_commit_rollback)
+{
+    auto path = temp_store_path("bb_file_store_basic");
+    std::vector<uint8_t> key = { 1, 2, 3 };
+    std::vector<uint8_t> value = { 4, 5, 6, 7 };
+    std::vector<uint8_t> result;
+    {
+        FileStore store(path);
+        EXPECT_FALSE(store.get(key, result));
+
+        store.put(key, value);
+        EXPECT_TRUE(store.get(key, result));
+        EXPECT_EQ(result, value);
+        store.rollback();
+        EXPECT_FALSE(store.get(key, result));
+
+        store.put(key, value);
+        store.commit();
+        EXPECT_EQ(store.size(), 1UL);
+
+        store.del(key);
+        EXPECT_FALSE(store.get(key, result));
+        store.rollback();
+        EXPECT_TRUE(store.get(key, result));
+    }
+    {
+        // Committed entries survive reopening, uncommitted ones do not.
+        FileStore store(path);
+        EXPECT_TRUE(store.get(key, result));
+        EXPECT_EQ(result, value);
+        store.del(key);
+        store.put(std::vector<uint8_t>{ 9 }, { 9 });
+    }
+    {
+        FileStore store(path);
+        EXPECT_TRUE(store.get(key, result));
+        EXPECT_FALSE(store.get(std::vector<uint8_t>{ 9 }, result));
+        store.del(key);
+        store.commit();
+        EXPECT_FALSE(store.get(key, result));
+        EXPECT_EQ(store.size(), 0UL);
+    }
+    std::filesystem::remove(path);
+}
+
+TEST(stdlib_merkle_tree_file_store, tree_matches_memory_store_across_restarts)
+{
+    constexpr size_t depth = 32;
+    constexpr size_t num_leaves = 300;
+    auto path = temp_store_path("bb_file_store_tree");
+
+    MemoryStore memory_store;
+    MerkleTree memory_db(memory_store, depth);
+
+    // A tiny cache and table, so the test exercises page eviction and table growth.
+    {
+        FileStore file_store(path, 4, 32);
+        MerkleTree file_db(file_store, depth);
+        for (size_t i = 0; i < num_leaves; ++i) {
+            auto value = fr(i * 7 + 1);
+            memory_db.update_element(i * 3, value);
+            file_db.update_element(i * 3, value);
+            if (i % 50 == 0) {
+                file_store.commit();
+            }
+        }
+        file_store.commit();
+        EXPECT_EQ(file_db.root(), memory_db.root());
+    }
+
+    FileStore file_store(path, 4);
+    MerkleTree file_db(file_store, depth);
+    EXPECT_EQ(file_db.root(), memory_db.root());
+    EXPECT_EQ(file_db.size(), memory_db.size());
+    for (size_t i = 0; i < num_leaves; i += 17) {
+        EXPECT_EQ(file_db.get_hash_path(i * 3), memory_db.get_hash_path(i * 3));
+        EXPECT_EQ(file_db.get_sibling_path(i * 3 + 1), memory_db.get_sibling_path(i * 3 + 1));
+    }
+    std::filesystem::remove(path);
+}
+
+} // namespace proof_system::test_stdlib_merkle_tree
@@ -1,4 +1,5 @@
 #include "memory_tree.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "hash.hpp"
 
 namespace proof_system::plonk {
@@ -60,6 +61,7 @@ fr_sibling_path MemoryTree::get_sibling_path(size_t index)
 
 fr MemoryTree::update_element(size_t index, fr const& value)
 {
+    size_ = index + 1;
     size_t offset = 0;
     size_t layer_size = total_size_;
     fr current = value;
@@ -75,6 +77,42 @@ fr MemoryTree::update_element(size_t index, fr const& value)
     return root_;
 }
 
+fr MemoryTree::update_elements(size_t start_index, std::span<const fr> values)
+{
+    if (values.empty()) {
+        return root_;
+    }
+    ASSERT(start_index + values.size() <= total_size_);
+    std::copy(values.begin(), values.end(), hashes_.begin() + static_cast<std::ptrdiff_t>(start_index));
+    size_ = start_index + values.size();
+
+    // The dirty range of each layer is [first, last]. Its parents are the dirty range of the next layer up.
+    size_t first = start_index;
+    size_t last = start_index + values.size() - 1;
+    size_t offset = 0;
+    size_t layer_size = total_size_;
+    for (size_t i = 0; i < depth_ - 1; ++i) {
+        const size_t next_offset = offset + layer_size;
+        first >>= 1;
+        last >>= 1;
+        const size_t num_parents = last - first + 1;
+        compute_parents_native(std::span<const fr>(&hashes_[offset + 2 * first], num_parents * 2),
+                               std::span<fr>(&hashes_[next_offset + first], num_parents));
+        offset = next_offset;
+        layer_size >>= 1;
+    }
+    root_ = hash_pair_native(hashes_[offset], hashes_[offset + 1]);
+    return root_;
+}
+
+fr MemoryTree::append_subtree(std::span<const fr> values)
+{
+    const size_t subtree_size = values.size();
+    ASSERT(subtree_size > 0 && subtree_size == (1UL << numeric::get_msb(subtree_size)));
+    const size_t start_index = (size_ + subtree_size - 1) & ~(subtree_size - 1);
+    return update_elements(start_index, values);
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
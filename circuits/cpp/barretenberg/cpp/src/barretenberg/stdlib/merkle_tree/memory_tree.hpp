@@ -1,5 +1,6 @@
 #pragma once
 #include "hash_path.hpp"
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -34,11 +35,27 @@ class MemoryTree {
 
     fr update_element(size_t index, fr const& value);
 
+    /**
+     * Sets the leaves from `start_index` onwards to `values`. Each affected layer is rehashed once, in parallel, so
+     * writing n contiguous leaves costs about n + depth hashes rather than n * depth.
+     */
+    fr update_elements(size_t start_index, std::span<const fr> values);
+
+    /**
+     * Appends `values` (whose size must be a power of two) as a complete subtree, at the first suitably aligned index
+     * at or after size().
+     */
+    fr append_subtree(std::span<const fr> values);
+
     fr root() const { return root_; }
 
+    // One past the index of the most recently updated leaf.
+    size_t size() const { return size_; }
+
   public:
     size_t depth_;
     size_t total_size_;
+    size_t size_ = 0;
     barretenberg::fr root_;
     std::vector<barretenberg::fr> hashes_;
 };
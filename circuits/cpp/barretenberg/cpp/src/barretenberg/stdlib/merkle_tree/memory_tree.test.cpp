@@ -78,3 +78,34 @@ TEST(stdlib_merkle_tree, test_memory_store_sibling_path)
     EXPECT_EQ(db.get_sibling_path(3), expected03);
     EXPECT_EQ(db.root(), root);
 }
+
+TEST(stdlib_merkle_tree, test_memory_tree_update_elements)
+{
+    constexpr size_t depth = 6;
+    MemoryTree batched(depth);
+    MemoryTree sequential(depth);
+
+    std::vector<fr> values(13);
+    for (size_t i = 0; i < values.size(); ++i) {
+        values[i] = fr(i + 100);
+    }
+    batched.update_element(2, fr(7));
+    sequential.update_element(2, fr(7));
+
+    batched.update_elements(5, values);
+    for (size_t i = 0; i < values.size(); ++i) {
+        sequential.update_element(5 + i, values[i]);
+    }
+    EXPECT_EQ(batched.root(), sequential.root());
+    EXPECT_EQ(batched.size(), sequential.size());
+    EXPECT_EQ(batched.hashes_, sequential.hashes_);
+
+    // Appends at index 32, the first multiple of 16 at or after size() = 18.
+    batched.append_subtree(std::span(values.data(), 16));
+    for (size_t i = 0; i < 16; ++i) {
+        sequential.update_element(32 + i, values[i]);
+    }
+    EXPECT_EQ(batched.root(), sequential.root());
+    EXPECT_EQ(batched.size(), 48UL);
+    EXPECT_EQ(batched.hashes_, sequential.hashes_);
+}
@@ -1,8 +1,10 @@
 #include "merkle_tree.hpp"
 #include "barretenberg/common/net.hpp"
+#include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/numeric/bitop/count_leading_zeros.hpp"
 #include "barretenberg/numeric/bitop/keep_n_lsb.hpp"
 #include "barretenberg/numeric/uint128/uint128.hpp"
+#include "file_store.hpp"
 #include "hash.hpp"
 #include "memory_store.hpp"
 #include <iostream>
@@ -216,6 +218,120 @@ template <typename Store> fr MerkleTree<Store>::update_element(index_t index, fr
     return r;
 }
 
+template <typename Store>
+fr MerkleTree<Store>::update_elements(index_t start_index, std::span<const fr> values)
+{
+    if (values.empty()) {
+        return root();
+    }
+
+    using serialize::write;
+    for (size_t i = 0; i < values.size(); ++i) {
+        std::vector<uint8_t> leaf_key;
+        write(leaf_key, tree_id_);
+        write(leaf_key, start_index + i);
+        store_.put(leaf_key, to_buffer(values[i]));
+    }
+
+    // Split the range into the largest blocks that are complete, aligned subtrees.
+    auto r = root();
+    index_t index = start_index;
+    size_t offset = 0;
+    while (offset < values.size()) {
+        const size_t remaining = values.size() - offset;
+        size_t height = 0;
+        while (height < depth_ && !bit_set(index, height) && (2UL << height) <= remaining) {
+            ++height;
+        }
+        const size_t block_size = 1UL << height;
+        auto subtree_root = put_subtree(values.subspan(offset, block_size));
+        r = update_subtree(r, subtree_root, index, depth_, height);
+        index += block_size;
+        offset += block_size;
+    }
+
+    std::vector<uint8_t> meta_key = { tree_id_ };
+    std::vector<uint8_t> meta_buf;
+    write(meta_buf, r);
+    write(meta_buf, index);
+    store_.put(meta_key, meta_buf);
+
+    return r;
+}
+
+template <typename Store> fr MerkleTree<Store>::append_subtree(std::span<const fr> values)
+{
+    const size_t subtree_size = values.size();
+    ASSERT(subtree_size > 0 && subtree_size == (1UL << numeric::get_msb(subtree_size)));
+    const index_t start_index = ((size() + subtree_size - 1) / subtree_size) * subtree_size;
+    return update_elements(start_index, values);
+}
+
+template <typename Store> fr MerkleTree<Store>::put_subtree(std::span<const fr> values)
+{
+    std::vector<fr> layer(values.begin(), values.end());
+    for (size_t height = 1; layer.size() > 1; ++height) {
+        std::vector<fr> parents(layer.size() / 2);
+        compute_parents_native(layer, parents);
+        // The store is not thread safe, so the nodes are written back on this thread.
+        for (size_t i = 0; i < parents.size(); ++i) {
+            if (height == depth_ || !(parents[i] == zero_hashes_[height])) {
+                put(parents[i], layer[2 * i], layer[2 * i + 1]);
+            }
+        }
+        layer = std::move(parents);
+    }
+    return layer[0];
+}
+
+template <typename Store>
+fr MerkleTree<Store>::update_subtree(
+    fr const& root, fr const& subtree_root, index_t index, size_t height, size_t subtree_height)
+{
+    if (height == subtree_height) {
+        return subtree_root;
+    }
+
+    std::vector<uint8_t> data;
+    auto status = store_.get(root.to_buffer(), data);
+    const bool is_regular = status && data.size() == REGULAR_NODE_SIZE;
+
+    fr left = zero_hashes_[height - 1];
+    fr right = zero_hashes_[height - 1];
+    if (is_regular) {
+        left = from_buffer<fr>(data, 0);
+        right = from_buffer<fr>(data, 32);
+    } else if (status) {
+        // We've come across a stump. Unless the subtree being inserted covers its element, push the element down into
+        // the appropriate child, and carry on as for a regular node.
+        ASSERT(data.size() == STUMP_NODE_SIZE);
+        fr existing_value = from_buffer<fr>(data, 0);
+        index_t existing_index = from_buffer<index_t>(data, 32);
+        if ((existing_index >> subtree_height) != (index >> subtree_height)) {
+            size_t stump_height = height - 1;
+            index_t stump_index = numeric::keep_n_lsb(existing_index, stump_height);
+            fr child = existing_value;
+            if (stump_height > 0) {
+                child = compute_zero_path_hash(stump_height, stump_index, existing_value);
+                put_stump(child, stump_index, existing_value);
+            }
+            (bit_set(existing_index, height - 1) ? right : left) = child;
+        }
+    }
+
+    bool is_right = bit_set(index, height - 1);
+    fr& child = is_right ? right : left;
+    fr old_child = child;
+    child = update_subtree(old_child, subtree_root, numeric::keep_n_lsb(index, height - 1), height - 1, subtree_height);
+    auto new_root = hash_pair_native(left, right);
+    put(new_root, left, right);
+
+    if (is_regular && !(old_child == child)) {
+        remove(old_child);
+    }
+    return new_root;
+}
+
 template <typename Store> fr MerkleTree<Store>::binary_put(index_t a_index, fr const& a, fr const& b, size_t height)
 {
     bool a_is_right = bit_set(a_index, height - 1);
@@ -352,6 +468,7 @@ template <typename Store> void MerkleTree<Store>::remove(fr const& key)
 }
 
 template class MerkleTree<MemoryStore>;
+template class MerkleTree<FileStore>;
 
 } // namespace merkle_tree
 } // namespace stdlib
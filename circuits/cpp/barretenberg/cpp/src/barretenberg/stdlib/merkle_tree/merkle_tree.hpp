@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "hash_path.hpp"
+#include <span>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -9,6 +10,7 @@ namespace merkle_tree {
 using namespace barretenberg;
 
 class MemoryStore;
+class FileStore;
 
 template <typename Store> class MerkleTree {
   public:
@@ -25,6 +27,21 @@ template <typename Store> class MerkleTree {
 
     fr update_element(index_t index, fr const& value);
 
+    /**
+     * Sets the leaves from `start_index` onwards to `values`.
+     *
+     * The range is split into aligned power-of-two blocks. Each block's subtree is hashed a layer at a time, in
+     * parallel, and then spliced into the tree with a single path update. Writing n contiguous leaves hence costs about
+     * n + depth hashes rather than n * depth.
+     */
+    fr update_elements(index_t start_index, std::span<const fr> values);
+
+    /**
+     * Appends `values` (whose size must be a power of two) as a complete subtree, at the first suitably aligned index
+     * at or after size().
+     */
+    fr append_subtree(std::span<const fr> values);
+
     fr root() const;
 
     size_t depth() const { return depth_; }
@@ -47,6 +64,18 @@ template <typename Store> class MerkleTree {
 
     fr get_element(fr const& root, index_t index, size_t height);
 
+    /**
+     * Hashes a complete subtree with `values` as its leaves and stores its nodes, returning its root.
+     * Nodes of empty subtrees are not stored, as lookups treat missing nodes as empty already.
+     */
+    fr put_subtree(std::span<const fr> values);
+
+    /**
+     * Like update_element, but replaces the whole subtree of height `subtree_height` containing `index` with the
+     * (already stored) subtree with root `subtree_root`.
+     */
+    fr update_subtree(fr const& root, fr const& subtree_root, index_t index, size_t height, size_t subtree_height);
+
     /**
      * Computes the root hash of a tree of `height`, that is empty other than `value` at `index`.
      *
@@ -98,6 +127,7 @@ template <typename Store> class MerkleTree {
 };
 
 extern template class MerkleTree<MemoryStore>;
+extern template class MerkleTree<FileStore>;
 
 } // namespace merkle_tree
 } // namespace stdlib
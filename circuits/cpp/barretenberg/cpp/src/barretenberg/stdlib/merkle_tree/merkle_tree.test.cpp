@@ -184,4 +184,60 @@ TEST(stdlib_merkle_tree, test_get_sibling_path_layers)
         EXPECT_NE(before[2], after[2]);
     }
 }
-} // namespace proof_system::test_stdlib_merkle_tree
\ No newline at end of file
+TEST(stdlib_merkle_tree, test_update_elements)
+{
+    constexpr size_t depth = 32;
+    MemoryStore store;
+    MerkleTree db(store, depth);
+    MemoryStore sequential_store;
+    MerkleTree sequential_db(sequential_store, depth);
+
+    // Existing leaves on either side of, and inside, the updated range, so the batch has to split stumps.
+    for (size_t index : { 3UL, 20UL, 100UL, 1000UL }) {
+        db.update_element(index, VALUES[index]);
+        sequential_db.update_element(index, VALUES[index]);
+    }
+
+    const size_t start_index = 13;
+    auto values = std::span(VALUES).subspan(500, 77);
+    db.update_elements(start_index, values);
+    for (size_t i = 0; i < values.size(); ++i) {
+        sequential_db.update_element(start_index + i, values[i]);
+    }
+
+    EXPECT_EQ(db.root(), sequential_db.root());
+    EXPECT_EQ(db.size(), sequential_db.size());
+    for (size_t index = 0; index < 128; ++index) {
+        EXPECT_EQ(db.get_hash_path(index), sequential_db.get_hash_path(index));
+        EXPECT_EQ(db.get_sibling_path(index), sequential_db.get_sibling_path(index));
+    }
+    EXPECT_EQ(db.get_hash_path(1000), sequential_db.get_hash_path(1000));
+
+    // Single element updates still work on top of a batch update.
+    db.update_element(40, VALUES[1]);
+    sequential_db.update_element(40, VALUES[1]);
+    EXPECT_EQ(db.root(), sequential_db.root());
+}
+
+TEST(stdlib_merkle_tree, test_append_subtree)
+{
+    constexpr size_t depth = 10;
+    MemoryTree memdb(depth);
+    MemoryStore store;
+    MerkleTree db(store, depth);
+
+    memdb.update_element(0, VALUES[1]);
+    db.update_element(0, VALUES[1]);
+    for (size_t i = 0; i < 4; ++i) {
+        auto subtree = std::span(VALUES).subspan(64 * i, 64);
+        memdb.append_subtree(subtree);
+        db.append_subtree(subtree);
+        EXPECT_EQ(db.root(), memdb.root());
+        EXPECT_EQ(db.size(), 64 * (i + 2));
+    }
+    for (size_t index = 0; index < 320; index += 7) {
+        EXPECT_EQ(db.get_hash_path(index), memdb.get_hash_path(index));
+    }
+}
+
+} // namespace proof_system::test_stdlib_merkle_tree
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/crypto/pedersen_commitment/pedersen.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
+#include <map>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -86,32 +87,63 @@ class WrappedNullifierLeaf {
     std::optional<nullifier_leaf> data;
 };
 
-inline std::pair<size_t, bool> find_closest_leaf(std::vector<WrappedNullifierLeaf> const& leaves_, fr const& new_value)
-{
-    std::vector<uint256_t> diff;
-    bool repeated = false;
-    auto new_value_ = uint256_t(new_value);
-
-    for (size_t i = 0; i < leaves_.size(); i++) {
+/**
+ * @brief An ordered index from the values of a nullifier tree's leaves to their positions, kept alongside the leaves.
+ *
+ * Finding the low leaf of a new value (the leaf with the largest value below it) is then a predecessor search, taking
+ * O(log n) rather than a scan over every leaf. Empty leaves are not indexed.
+ */
+class NullifierLeafIndex {
+  public:
+    /**
+     * @brief Record that the leaf at `index` holds `value`. If another leaf already holds `value`, the first one wins.
+     */
+    void insert(fr const& value, size_t index) { index_.emplace(uint256_t(value), index); }
 
-        if (!leaves_[i].has_value()) {
-            diff.push_back(new_value_);
-            continue;
-        }
+    /**
+     * @brief Find the leaf holding `new_value` if there is one, otherwise the leaf with the largest value below it.
+     *
+     * @return The index of that leaf, and whether it holds `new_value`
+     */
+    std::pair<size_t, bool> find_closest_leaf(fr const& new_value) const
+    {
+        auto value = uint256_t(new_value);
+        auto it = index_.upper_bound(value);
+        // The leaf with value 0 at index 0 is always present, so every value has a low leaf.
+        ASSERT(it != index_.begin());
+        --it;
+        return std::make_pair(it->second, it->first == value);
+    }
 
-        auto leaf_value_ = uint256_t(leaves_[i].unwrap().value);
-        if (leaf_value_ > new_value_) {
-            diff.push_back(leaf_value_);
-        } else if (leaf_value_ == new_value_) {
-            repeated = true;
-            return std::make_pair(i, repeated);
-        } else {
-            diff.push_back(new_value_ - leaf_value_);
+    /**
+     * @brief find_closest_leaf for each of `values`, which must be in increasing order.
+     *
+     * Values that fall between the same pair of leaves share a single search, so a sorted batch costs O(log n) per
+     * distinct gap it lands in rather than per value.
+     */
+    std::vector<std::pair<size_t, bool>> find_closest_leaves(std::vector<uint256_t> const& values) const
+    {
+        std::vector<std::pair<size_t, bool>> result;
+        result.reserve(values.size());
+        auto next = index_.begin();
+        for (auto const& value : values) {
+            // `next` is the first leaf above the previous value. Unless it is also at or below this value, this value
+            // falls in the same gap, and has the same low leaf.
+            if (next == index_.begin() || (next != index_.end() && next->first <= value)) {
+                next = index_.upper_bound(value);
+            }
+            ASSERT(next != index_.begin());
+            auto low = std::prev(next);
+            result.emplace_back(low->second, low->first == value);
         }
+        return result;
     }
-    auto it = std::min_element(diff.begin(), diff.end());
-    return std::make_pair(static_cast<size_t>(it - diff.begin()), repeated);
-}
+
+    size_t size() const { return index_.size(); }
+
+  private:
+    std::map<uint256_t, size_t> index_;
+};
 
 } // namespace merkle_tree
 } // namespace stdlib
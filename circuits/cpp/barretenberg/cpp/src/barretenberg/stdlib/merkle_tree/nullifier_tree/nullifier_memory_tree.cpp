@@ -1,5 +1,8 @@
 #include "nullifier_memory_tree.hpp"
 #include "../hash.hpp"
+#include "barretenberg/common/thread.hpp"
+#include <algorithm>
+#include <set>
 
 namespace proof_system::plonk {
 namespace stdlib {
@@ -25,6 +28,7 @@ NullifierMemoryTree::NullifierMemoryTree(size_t depth)
     // Insert the initial leaf at index 0
     auto initial_leaf = WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves_.push_back(initial_leaf);
+    leaf_index_.insert(0, 0);
     root_ = update_element(0, initial_leaf.hash());
 }
 
@@ -41,7 +45,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
 
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = find_closest_leaf(value);
 
     nullifier_leaf current_leaf = leaves_[current].unwrap();
     nullifier_leaf new_leaf = { .value = value,
@@ -57,6 +61,7 @@ fr NullifierMemoryTree::update_element(fr const& value)
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
         leaves_.push_back(new_leaf);
+        leaf_index_.insert(value, leaves_.size() - 1);
     }
 
     // Update the old leaf in the tree
@@ -72,6 +77,66 @@ fr NullifierMemoryTree::update_element(fr const& value)
     return root;
 }
 
+fr NullifierMemoryTree::update_elements(std::vector<fr> const& values)
+{
+    // Sort by value, breaking ties by position so the first occurrence of a repeated value comes first.
+    std::vector<std::pair<uint256_t, size_t>> sorted(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        sorted[i] = { uint256_t(values[i]), i };
+    }
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<uint256_t> sorted_values(sorted.size());
+    std::transform(sorted.begin(), sorted.end(), sorted_values.begin(), [](auto const& v) { return v.first; });
+    auto low_leaves = leaf_index_.find_closest_leaves(sorted_values);
+
+    // Assign leaf indices in insertion order. Zeros get an empty leaf each, repeated values get no leaf.
+    std::vector<bool> is_new(values.size(), false);
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        const bool repeated_in_block = i > 0 && sorted[i].first == sorted[i - 1].first;
+        is_new[sorted[i].second] = sorted[i].first != 0 && !low_leaves[i].second && !repeated_in_block;
+    }
+    const size_t start_index = leaves_.size();
+    std::vector<size_t> leaf_indices(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (values[i] == 0 || is_new[i]) {
+            leaf_indices[i] = leaves_.size();
+            leaves_.push_back(WrappedNullifierLeaf::zero());
+        }
+    }
+
+    // Link the new leaves in increasing order. A value's low leaf is the previous new value if that fell in the same
+    // gap between existing leaves, and otherwise the existing leaf found above.
+    std::set<size_t> updated_low_leaves;
+    for (size_t i = 0, previous = sorted.size(); i < sorted.size(); ++i) {
+        const size_t position = sorted[i].second;
+        if (!is_new[position]) {
+            continue;
+        }
+        const bool same_gap = previous < sorted.size() && low_leaves[previous].first == low_leaves[i].first;
+        const size_t low_index = same_gap ? leaf_indices[sorted[previous].second] : low_leaves[i].first;
+
+        nullifier_leaf low_leaf = leaves_[low_index].unwrap();
+        leaves_[leaf_indices[position]].set(
+            { .value = values[position], .nextIndex = low_leaf.nextIndex, .nextValue = low_leaf.nextValue });
+        low_leaf.nextIndex = leaf_indices[position];
+        low_leaf.nextValue = values[position];
+        leaves_[low_index].set(low_leaf);
+        leaf_index_.insert(values[position], leaf_indices[position]);
+
+        if (low_index < start_index) {
+            updated_low_leaves.insert(low_index);
+        }
+        previous = i;
+    }
+
+    for (size_t index : updated_low_leaves) {
+        update_element(index, leaves_[index].hash());
+    }
+    std::vector<fr> new_hashes(leaves_.size() - start_index);
+    parallel_for(new_hashes.size(), [&](size_t i) { new_hashes[i] = leaves_[start_index + i].hash(); });
+    return update_elements(start_index, new_hashes);
+}
+
 } // namespace merkle_tree
 } // namespace stdlib
 } // namespace proof_system::plonk
\ No newline at end of file
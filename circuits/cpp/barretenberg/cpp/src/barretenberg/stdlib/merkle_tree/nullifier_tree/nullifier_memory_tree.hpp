@@ -75,9 +75,21 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::get_hash_path;
     using MemoryTree::root;
     using MemoryTree::update_element;
+    using MemoryTree::update_elements;
 
     fr update_element(fr const& value);
 
+    /**
+     * @brief Insert a block of nullifiers, leaving the tree exactly as inserting them one by one in order would.
+     *
+     * The values are sorted, so the low leaves are found with one pass over the ordered index (see
+     * NullifierLeafIndex::find_closest_leaves). The new leaves are contiguous, so they are hashed into the tree in
+     * one batch, and only the existing low leaves are updated one path at a time.
+     */
+    fr update_elements(std::vector<fr> const& values);
+
+    std::pair<size_t, bool> find_closest_leaf(fr const& value) const { return leaf_index_.find_closest_leaf(value); }
+
     const std::vector<barretenberg::fr>& get_hashes() { return hashes_; }
     const WrappedNullifierLeaf get_leaf(size_t index)
     {
@@ -91,6 +103,7 @@ class NullifierMemoryTree : public MemoryTree {
     using MemoryTree::root_;
     using MemoryTree::total_size_;
     std::vector<WrappedNullifierLeaf> leaves_;
+    NullifierLeafIndex leaf_index_;
 };
 
 } // namespace merkle_tree
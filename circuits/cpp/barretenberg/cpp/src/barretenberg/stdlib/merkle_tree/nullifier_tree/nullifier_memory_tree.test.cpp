@@ -368,4 +368,34 @@ TEST(crypto_nullifier_tree, test_nullifier_tree)
     // Merkle proof at `index` proves non-membership of `new_member`
     auto hash_path = tree.get_hash_path(index);
     EXPECT_TRUE(check_hash_path(tree.root(), hash_path, leaves[index].unwrap(), index));
-}
\ No newline at end of file
+}
+TEST(crypto_nullifier_tree, test_nullifier_tree_batch_insert)
+{
+    constexpr size_t depth = 8;
+    NullifierMemoryTree batched(depth);
+    NullifierMemoryTree sequential(depth);
+
+    std::vector<fr> existing = { 30, 10, 1000, 20 };
+    for (auto& value : existing) {
+        batched.update_element(value);
+        sequential.update_element(value);
+    }
+
+    // Several values in the same gaps, values below and above every leaf, zeros, and values repeated within the block
+    // or already in the tree.
+    std::vector<fr> block = { 25, 0, 21, 2000, 5, 22, 10, 25, 0, 999, 1001, fr::random_element(), 11 };
+    for (size_t i = 0; i < 16; ++i) {
+        block.push_back(fr::random_element());
+    }
+    batched.update_elements(block);
+    for (auto& value : block) {
+        sequential.update_element(value);
+    }
+
+    EXPECT_EQ(batched.get_leaves(), sequential.get_leaves());
+    EXPECT_EQ(batched.root(), sequential.root());
+    EXPECT_EQ(batched.get_hashes(), sequential.get_hashes());
+    for (auto& value : block) {
+        EXPECT_EQ(batched.find_closest_leaf(value), sequential.find_closest_leaf(value));
+    }
+}
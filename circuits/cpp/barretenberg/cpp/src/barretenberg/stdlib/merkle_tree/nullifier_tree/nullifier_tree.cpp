@@ -32,6 +32,7 @@ NullifierTree<Store>::NullifierTree(Store& store, size_t depth, uint8_t tree_id)
     WrappedNullifierLeaf initial_leaf =
         WrappedNullifierLeaf(nullifier_leaf{ .value = 0, .nextIndex = 0, .nextValue = 0 });
     leaves.push_back(initial_leaf);
+    leaf_index.insert(0, 0);
     update_element(0, initial_leaf.hash());
 
     // Create the zero hashes for the tree
@@ -54,7 +55,7 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
     // Find the leaf with the value closest and less than `value`
     size_t current;
     bool is_already_present;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves, value);
+    std::tie(current, is_already_present) = leaf_index.find_closest_leaf(value);
 
     nullifier_leaf current_leaf = leaves[current].unwrap();
     WrappedNullifierLeaf new_leaf = WrappedNullifierLeaf(
@@ -68,6 +69,7 @@ template <typename Store> fr NullifierTree<Store>::update_element(fr const& valu
 
         // Insert the new leaf with (nextIndex, nextValue) of the current leaf
         leaves.push_back(new_leaf);
+        leaf_index.insert(value, leaves.size() - 1);
     }
 
     // Update the old leaf in the tree
@@ -25,15 +25,15 @@ template <typename... Args> inline void info_togglable(Args... args)
 template <typename... Args> inline void info_togglable(Args...) {}
 #endif
 
-std::array<uint8_t, Keccak256Hasher::PRNG_OUTPUT_SIZE> Keccak256Hasher::hash(std::vector<uint8_t> const& buffer)
+namespace {
+std::array<uint8_t, Keccak256Hasher::PRNG_OUTPUT_SIZE> keccak256_to_bytes(keccak256 hash_result)
 {
-    keccak256 hash_result = ethash_keccak256(&buffer[0], buffer.size());
     for (auto& word : hash_result.word64s) {
         if (is_little_endian()) {
             word = __builtin_bswap64(word);
         }
     }
-    std::array<uint8_t, PRNG_OUTPUT_SIZE> result;
+    std::array<uint8_t, Keccak256Hasher::PRNG_OUTPUT_SIZE> result;
 
     for (size_t i = 0; i < 4; ++i) {
         for (size_t j = 0; j < 8; ++j) {
@@ -43,6 +43,34 @@ std::array<uint8_t, Keccak256Hasher::PRNG_OUTPUT_SIZE> Keccak256Hasher::hash(std
     }
     return result;
 }
+} // namespace
+
+std::array<uint8_t, Keccak256Hasher::PRNG_OUTPUT_SIZE> Keccak256Hasher::hash(std::vector<uint8_t> const& buffer)
+{
+    return keccak256_to_bytes(ethash_keccak256(&buffer[0], buffer.size()));
+}
+
+/**
+ * Hashes independent buffers together, which lets Keccak run the permutation on several of them side by side.
+ * */
+std::vector<std::array<uint8_t, Keccak256Hasher::PRNG_OUTPUT_SIZE>> Keccak256Hasher::hash_batch(
+    std::vector<std::vector<uint8_t>> const& buffers)
+{
+    std::vector<const uint8_t*> data;
+    std::vector<size_t> sizes;
+    for (const auto& buffer : buffers) {
+        data.push_back(&buffer[0]);
+        sizes.push_back(buffer.size());
+    }
+    std::vector<keccak256> hash_results(buffers.size());
+    ethash_keccak256_batch(data.data(), sizes.data(), buffers.size(), hash_results.data());
+
+    std::vector<std::array<uint8_t, PRNG_OUTPUT_SIZE>> results;
+    for (const auto& hash_result : hash_results) {
+        results.push_back(keccak256_to_bytes(hash_result));
+    }
+    return results;
+}
 
 std::array<uint8_t, Blake3sHasher::PRNG_OUTPUT_SIZE> Blake3sHasher::hash(std::vector<uint8_t> const& buffer)
 {
@@ -279,13 +307,23 @@ void Transcript::apply_fiat_shamir(const std::string& challenge_name /*, const b
         ++num_hashes;
     }
 
+    // These hashes do not depend on each other, so with Keccak they are computed as one batch.
+    std::vector<std::array<uint8_t, PRNG_OUTPUT_SIZE>> keccak_outputs;
+    if (hasher == HashType::Keccak256 && num_hashes > 1) {
+        std::vector<std::vector<uint8_t>> rolling_buffers(num_hashes - 1, rolling_buffer);
+        for (size_t i = 1; i < num_hashes; ++i) {
+            rolling_buffers[i - 1][rolling_buffer.size() - 1] = static_cast<uint8_t>(i);
+        }
+        keccak_outputs = Keccak256Hasher::hash_batch(rolling_buffers);
+    }
+
     for (size_t i = 1; i < num_hashes; ++i) {
         // Compute hash_output = hash(base_hash, i);
         rolling_buffer[rolling_buffer.size() - 1] = static_cast<uint8_t>(i);
         std::array<uint8_t, PRNG_OUTPUT_SIZE> hash_output{};
         switch (hasher) {
         case HashType::Keccak256: {
-            hash_output = Keccak256Hasher::hash(rolling_buffer);
+            hash_output = keccak_outputs[i - 1];
             break;
         }
         case HashType::PedersenBlake3s: {
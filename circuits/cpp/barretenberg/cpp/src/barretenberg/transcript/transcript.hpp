@@ -15,6 +15,8 @@ struct Keccak256Hasher {
     static constexpr size_t PRNG_OUTPUT_SIZE = 32;
 
     static std::array<uint8_t, PRNG_OUTPUT_SIZE> hash(std::vector<uint8_t> const& buffer);
+    static std::vector<std::array<uint8_t, PRNG_OUTPUT_SIZE>> hash_batch(
+        std::vector<std::vector<uint8_t>> const& buffers);
 };
 
 struct Blake3sHasher {
@@ -188,4 +188,23 @@ TEST(transcript, univariate_serialization)
     for (size_t i = 0; i < LENGTH; ++i) {
         EXPECT_EQ(univariate.value_at(i), deserialized_univariate.value_at(i));
     }
-}
\ No newline at end of file
+}
+TEST(transcript, keccak_hash_batch_matches_hash)
+{
+    // Buffers either side of Keccak-256's 136 byte block, and enough of them to leave a partial group
+    std::vector<std::vector<uint8_t>> buffers;
+    for (size_t i = 0; i < 21; ++i) {
+        std::vector<uint8_t> buffer(i * 15 + 1);
+        for (size_t j = 0; j < buffer.size(); ++j) {
+            buffer[j] = static_cast<uint8_t>(i + j * 3);
+        }
+        buffers.push_back(buffer);
+    }
+
+    auto results = transcript::Keccak256Hasher::hash_batch(buffers);
+
+    EXPECT_EQ(results.size(), buffers.size());
+    for (size_t i = 0; i < buffers.size(); ++i) {
+        EXPECT_EQ(results[i], transcript::Keccak256Hasher::hash(buffers[i]));
+    }
+}
@@ -56,7 +56,7 @@ NullifierMemoryTreeTestingHarness::circuit_prep_batch_insert(std::vector<fr> con
 
         size_t current = 0;
         bool is_already_present = false;
-        std::tie(current, is_already_present) = find_closest_leaf(leaves_, new_value);
+        std::tie(current, is_already_present) = find_closest_leaf(new_value);
 
         // If the inserted value is 0, then we ignore and provide a dummy low nullifier
         if (new_value == 0) {
@@ -145,7 +145,7 @@ std::pair<nullifier_leaf, size_t> NullifierMemoryTreeTestingHarness::find_lower(
 {
     size_t current = 0;
     bool is_already_present = false;
-    std::tie(current, is_already_present) = find_closest_leaf(leaves_, value);
+    std::tie(current, is_already_present) = find_closest_leaf(value);
 
     // TODO: handle is already present case
     if (!is_already_present) {